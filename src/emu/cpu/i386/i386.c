@@ -496,6 +496,7 @@ static STATE_POSTLOAD( i386_postload )
 	int i;
 	for (i = 0; i < 6; i++)
 		i386_load_segment_descriptor(cpustate,i);
+	i386_invalidate_fetch_cache(cpustate);
 	CHANGE_PC(cpustate,cpustate->eip);
 }
 
@@ -815,10 +816,10 @@ static CPU_SET_INFO( i386 )
 		case CPUINFO_INT_REGISTER + I386_GS_BASE:		cpustate->sreg[GS].base = info->i;				break;
 		case CPUINFO_INT_REGISTER + I386_GS_LIMIT:		cpustate->sreg[GS].limit = info->i;				break;
 		case CPUINFO_INT_REGISTER + I386_GS_FLAGS:		cpustate->sreg[GS].flags = info->i & 0xf0ff;	break;
-		case CPUINFO_INT_REGISTER + I386_CR0:			cpustate->cr[0] = info->i;						break;
+		case CPUINFO_INT_REGISTER + I386_CR0:			cpustate->cr[0] = info->i; i386_invalidate_fetch_cache(cpustate); break;
 		case CPUINFO_INT_REGISTER + I386_CR1:			cpustate->cr[1] = info->i;						break;
 		case CPUINFO_INT_REGISTER + I386_CR2:			cpustate->cr[2] = info->i;						break;
-		case CPUINFO_INT_REGISTER + I386_CR3:			cpustate->cr[3] = info->i;						break;
+		case CPUINFO_INT_REGISTER + I386_CR3:			cpustate->cr[3] = info->i; i386_invalidate_fetch_cache(cpustate); break;
 		case CPUINFO_INT_REGISTER + I386_DR0:			cpustate->dr[0] = info->i;						break;
 		case CPUINFO_INT_REGISTER + I386_DR1:			cpustate->dr[1] = info->i;						break;
 		case CPUINFO_INT_REGISTER + I386_DR2:			cpustate->dr[2] = info->i;						break;
@@ -654,9 +654,9 @@ static void I386OP(mov_cr_r32)(i386_state *cpustate)		// Opcode 0x0f 22
 	cpustate->cr[cr] = LOAD_RM32(modrm);
 	switch(cr)
 	{
-		case 0: CYCLES(cpustate,CYCLES_MOV_REG_CR0); break;
+		case 0: i386_invalidate_fetch_cache(cpustate); CYCLES(cpustate,CYCLES_MOV_REG_CR0); break;
 		case 2: CYCLES(cpustate,CYCLES_MOV_REG_CR2); break;
-		case 3: CYCLES(cpustate,CYCLES_MOV_REG_CR3); break;
+		case 3: i386_invalidate_fetch_cache(cpustate); CYCLES(cpustate,CYCLES_MOV_REG_CR3); break;
 		default:
 			fatalerror("i386: mov_cr_r32 CR%d !", cr);
 			break;
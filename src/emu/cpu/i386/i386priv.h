@@ -228,6 +228,11 @@ struct _i386_state
 	const address_space *io;
 	UINT32 a20_mask;
 
+	// instruction fetch translation cache
+	UINT32 fetch_page_linear;	// linear address of the cached code page
+	UINT32 fetch_page_physical;	// physical address of the cached code page
+	int fetch_page_valid;
+
 	int cpuid_max_input_value_eax;
 	UINT32 cpuid_id0, cpuid_id1, cpuid_id2;
 	UINT32 cpu_version;
@@ -351,43 +356,48 @@ INLINE int translate_address(i386_state *cpustate, UINT32 *address)
 	return 1;
 }
 
-INLINE void CHANGE_PC(i386_state *cpustate, UINT32 pc)
+/* the fetch cache behaves like a single-entry TLB, so it must be flushed */
+/* wherever the real TLB would be: CR0/CR3 writes, INVLPG and state loads */
+INLINE void i386_invalidate_fetch_cache(i386_state *cpustate)
 {
-	UINT32 address;
-	cpustate->pc = i386_translate(cpustate, CS, pc );
-
-	address = cpustate->pc;
+	cpustate->fetch_page_valid = 0;
+}
 
+INLINE UINT32 translate_fetch_address(i386_state *cpustate, UINT32 address)
+{
 	if (cpustate->cr[0] & 0x80000000)		// page translation enabled
 	{
-		translate_address(cpustate,&address);
+		UINT32 page = address & 0xfffff000;
+
+		if (!cpustate->fetch_page_valid || page != cpustate->fetch_page_linear)
+		{
+			UINT32 physical = page;
+			translate_address(cpustate,&physical);
+			cpustate->fetch_page_linear = page;
+			cpustate->fetch_page_physical = physical;
+			cpustate->fetch_page_valid = 1;
+		}
+		address = cpustate->fetch_page_physical | (address & 0xfff);
 	}
+	return address;
+}
+
+INLINE void CHANGE_PC(i386_state *cpustate, UINT32 pc)
+{
+	cpustate->pc = i386_translate(cpustate, CS, pc );
 }
 
 INLINE void NEAR_BRANCH(i386_state *cpustate, INT32 offs)
 {
-	UINT32 address;
 	/* TODO: limit */
 	cpustate->eip += offs;
 	cpustate->pc += offs;
-
-	address = cpustate->pc;
-
-	if (cpustate->cr[0] & 0x80000000)		// page translation enabled
-	{
-		translate_address(cpustate,&address);
-	}
 }
 
 INLINE UINT8 FETCH(i386_state *cpustate)
 {
 	UINT8 value;
-	UINT32 address = cpustate->pc;
-
-	if (cpustate->cr[0] & 0x80000000)		// page translation enabled
-	{
-		translate_address(cpustate,&address);
-	}
+	UINT32 address = translate_fetch_address(cpustate, cpustate->pc);
 
 	value = memory_decrypted_read_byte(cpustate->program, address & cpustate->a20_mask);
 	cpustate->eip++;
@@ -397,12 +407,7 @@ INLINE UINT8 FETCH(i386_state *cpustate)
 INLINE UINT16 FETCH16(i386_state *cpustate)
 {
 	UINT16 value;
-	UINT32 address = cpustate->pc;
-
-	if (cpustate->cr[0] & 0x80000000)		// page translation enabled
-	{
-		translate_address(cpustate,&address);
-	}
+	UINT32 address = translate_fetch_address(cpustate, cpustate->pc);
 
 	if( address & 0x1 ) {		/* Unaligned read */
 		address &= cpustate->a20_mask;
@@ -419,12 +424,7 @@ INLINE UINT16 FETCH16(i386_state *cpustate)
 INLINE UINT32 FETCH32(i386_state *cpustate)
 {
 	UINT32 value;
-	UINT32 address = cpustate->pc;
-
-	if (cpustate->cr[0] & 0x80000000)		// page translation enabled
-	{
-		translate_address(cpustate,&address);
-	}
+	UINT32 address = translate_fetch_address(cpustate, cpustate->pc);
 
 	if( cpustate->pc & 0x3 ) {		/* Unaligned read */
 		address &= cpustate->a20_mask;
@@ -284,7 +284,10 @@ static void I486OP(group0F01_16)(i386_state *cpustate)		// Opcode 0x0f 01
 			}
 		case 7:			/* INVLPG */
 			{
-				// Nothing to do ?
+				// we keep no data TLB, but the fetch cache may hold the page being invalidated
+				if (modrm < 0xc0)
+					GetEA(cpustate,modrm);
+				i386_invalidate_fetch_cache(cpustate);
 				break;
 			}
 		default:
@@ -357,7 +360,10 @@ static void I486OP(group0F01_32)(i386_state *cpustate)		// Opcode 0x0f 01
 			}
 		case 7:			/* INVLPG */
 			{
-				// Nothing to do ?
+				// we keep no data TLB, but the fetch cache may hold the page being invalidated
+				if (modrm < 0xc0)
+					GetEA(cpustate,modrm);
+				i386_invalidate_fetch_cache(cpustate);
 				break;
 			}
 		default:
@@ -190,6 +190,7 @@ struct _psxcpu_state
 	UINT32 bad_byte_address_mask;
 	UINT32 bad_half_address_mask;
 	UINT32 bad_word_address_mask;
+	UINT64 gte_count[ 64 ];
 };
 
 INLINE psxcpu_state *get_safe_token(const device_config *device)
@@ -248,6 +249,7 @@ static void setcp2dr( psxcpu_state *psxcpu, int reg, UINT32 value );
 static UINT32 getcp2cr( psxcpu_state *psxcpu, int reg );
 static void setcp2cr( psxcpu_state *psxcpu, int reg, UINT32 value );
 static void docop2( psxcpu_state *psxcpu, int op );
+static void gte_report_counts( psxcpu_state *psxcpu );
 
 
 static UINT32 getcp3dr( psxcpu_state *psxcpu, int reg );
@@ -1666,6 +1668,9 @@ static CPU_RESET( psxcpu )
 
 static CPU_EXIT( psxcpu )
 {
+	psxcpu_state *psxcpu = get_safe_token(device);
+
+	gte_report_counts( psxcpu );
 }
 
 static UINT32 mips_get_register_from_pipeline( psxcpu_state *psxcpu, int reg )
@@ -5334,14 +5339,10 @@ INLINE UINT32 gte_divide( INT16 numerator, UINT16 denominator )
 {
 	if( numerator >= 0 && numerator < ( denominator * 2 ) )
 	{
-		UINT32 offset = denominator;
-		int shift = 0;
+		/* normalise the denominator so that it is above 0x8000 */
+		int shift = count_leading_zeros( ( (UINT32)( denominator - 1 ) << 16 ) | 0x8000 );
+		UINT32 offset = denominator << shift;
 		UINT64 reciprocal;
-		while( offset <= 0x8000 )
-		{
-			offset <<= 1;
-			shift++;
-		}
 
 		reciprocal = (UINT64)( 0x10000 | reciprocals[ offset & 0x7fff ] ) << shift;
 
@@ -5390,6 +5391,8 @@ static void docop2( psxcpu_state *psxcpu, int gteop )
 	INT32 h_over_sz3;
 	INT64 mac0;
 
+	psxcpu->gte_count[ GTE_FUNCT( gteop ) ]++;
+
 	switch( GTE_FUNCT( gteop ) )
 	{
 	case 0x01:
@@ -5963,6 +5966,43 @@ static void docop2( psxcpu_state *psxcpu, int gteop )
 	mips_stop( psxcpu );
 }
 
+static void gte_report_counts( psxcpu_state *psxcpu )
+{
+	static const char *const gte_names[ 64 ] =
+	{
+		NULL,    "RTPS",  NULL,    NULL,    NULL,    NULL,    "NCLIP", NULL,
+		NULL,    NULL,    NULL,    NULL,    "OP",    NULL,    NULL,    NULL,
+		"DPCS",  "INTPL", "MVMVA", "NCDS",  "CDP",   NULL,    "NCDT",  NULL,
+		NULL,    NULL,    NULL,    "NCCS",  "CC",    NULL,    "NCS",   NULL,
+		"NCT",   NULL,    NULL,    NULL,    NULL,    NULL,    NULL,    NULL,
+		"SQR",   NULL,    "DPCT",  NULL,    NULL,    "AVSZ3", "AVSZ4", NULL,
+		"RTPT",  NULL,    NULL,    NULL,    NULL,    NULL,    NULL,    NULL,
+		NULL,    NULL,    NULL,    NULL,    NULL,    "GPF",   "GPL",   "NCCT"
+	};
+	UINT64 total = 0;
+	int funct;
+
+	for( funct = 0; funct < 64; funct++ )
+	{
+		total += psxcpu->gte_count[ funct ];
+	}
+
+	if( total == 0 )
+	{
+		return;
+	}
+
+	logerror( "%s: GTE command counts\n", psxcpu->device->tag );
+	for( funct = 0; funct < 64; funct++ )
+	{
+		if( psxcpu->gte_count[ funct ] != 0 )
+		{
+			logerror( "  %-6s %12.0f  %5.1f%%\n", ( gte_names[ funct ] != NULL ) ? gte_names[ funct ] : "???",
+				(double)psxcpu->gte_count[ funct ], (double)psxcpu->gte_count[ funct ] * 100.0 / (double)total );
+		}
+	}
+}
+
 /**************************************************************************
  * Generic set_info
  **************************************************************************/
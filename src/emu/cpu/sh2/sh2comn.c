@@ -343,6 +343,18 @@ WRITE32_HANDLER( sh2_internal_w )
 
 		// Standby and cache
 	case 0x24: // SBYCR, CCR
+#ifdef USE_SH2DRC
+		/* a cache purge (CCR.CP) is how software announces freshly loaded code;
+           end the timeslice so the DRC can check the memory its translated
+           blocks came from before the next block is dispatched */
+		if ((mem_mask & 0x0000ff00) && (sh2->m[0x24] & 0x00001000))
+		{
+			sh2->cache_purge = TRUE;
+			cpu_abort_timeslice(sh2->device);
+		}
+#endif
+		/* CP always reads back as zero */
+		sh2->m[0x24] &= ~0x00001000;
 		break;
 
 		// Interrupt vectors cont.
@@ -23,6 +23,18 @@
 
 #define SH2_CODE_XOR(a)		((a) ^ NATIVE_ENDIAN_VALUE_LE_BE(2,0))
 
+#ifdef USE_SH2DRC
+/* a range of memory that translated code was compiled from */
+typedef struct _sh2_code_range sh2_code_range;
+struct _sh2_code_range
+{
+	offs_t			start;					/* first byte address (dword aligned) */
+	offs_t			end;					/* last byte address */
+	const UINT8 *	base;					/* host pointer to the code when it was compiled */
+	UINT8 *			shadow;					/* copy of RAM code when it was compiled, NULL for ROM */
+};
+#endif
+
 typedef struct _irq_entry irq_entry;
 struct _irq_entry
 {
@@ -149,6 +161,14 @@ typedef struct
 
 	/* internal stuff */
 	UINT8				cache_dirty;		    	/* true if we need to flush the cache */
+	UINT8				cache_purge;				/* true if software purged the cache (CCR.CP) */
+
+	/* memory the translated code came from, checked on a cache purge */
+	sh2_code_range *	coderange;					/* recorded ranges */
+	UINT32				coderange_count;			/* number of recorded ranges */
+	UINT8				coderange_overflow;			/* true if some code can't be checked */
+	UINT8 *				codeshadow;					/* pool for the shadow copies of RAM code */
+	UINT32				codeshadow_used;			/* bytes of the pool in use */
 
 	/* parameters for subroutines */
 	UINT64				numcycles;		    	/* return value from gettotalcycles */
@@ -65,6 +65,11 @@ CPU_DISASSEMBLE( sh2 );
 #define COMPILE_MAX_INSTRUCTIONS		((COMPILE_BACKWARDS_BYTES/2) + (COMPILE_FORWARDS_BYTES/2))
 #define COMPILE_MAX_SEQUENCE			64
 
+/* code range tracking for cache purges */
+#define MAX_CODE_RANGES					4096
+#define CODE_SHADOW_SIZE				(1024 * 1024)
+#define CODE_RANGE_ALIGN				64
+
 /* exit codes */
 #define EXECUTE_OUT_OF_CYCLES			0
 #define EXECUTE_MISSING_CODE			1
@@ -118,6 +123,8 @@ static int generate_group_8(SH2 *sh2, drcuml_block *block, compiler_state *compi
 static int generate_group_12(SH2 *sh2, drcuml_block *block, compiler_state *compiler, const opcode_desc *desc, UINT16 opcode, int in_delay_slot);
 
 static void code_compile_block(SH2 *sh2, UINT8 mode, offs_t pc);
+static void code_range_record(SH2 *sh2, offs_t start, offs_t end);
+static int code_ranges_changed(SH2 *sh2);
 
 static void log_opcode_desc(drcuml_state *drcuml, const opcode_desc *desclist, int indent);
 static void log_register_list(drcuml_state *drcuml, const char *string, const UINT32 *reglist, const UINT32 *regnostarlist);
@@ -702,6 +709,10 @@ static CPU_INIT( sh2 )
 	/* allocate the implementation-specific state from the full cache */
 	sh2->cache = cache;
 
+	/* allocate the code range tracking */
+	sh2->coderange = auto_alloc_array(device->machine, sh2_code_range, MAX_CODE_RANGES);
+	sh2->codeshadow = auto_alloc_array(device->machine, UINT8, CODE_SHADOW_SIZE);
+
 	/* reset per-driver pcflushes */
 	sh2->pcfsel = 0;
 
@@ -875,9 +886,112 @@ static void code_flush_cache(SH2 *sh2)
 	static_generate_memory_accessor(sh2, 4, FALSE, "read32", &sh2->read32);
 	static_generate_memory_accessor(sh2, 4, TRUE,  "write32", &sh2->write32);
 
+	/* nothing is translated any more */
+	sh2->coderange_count = 0;
+	sh2->coderange_overflow = FALSE;
+	sh2->codeshadow_used = 0;
+
 	sh2->cache_dirty = FALSE;
 }
 
+
+/*-------------------------------------------------
+    code_range_record - note the memory a
+    sequence was compiled from
+-------------------------------------------------*/
+
+static void code_range_record(SH2 *sh2, offs_t start, offs_t end)
+{
+	sh2_code_range *range;
+	const UINT8 *base;
+	UINT32 index, length;
+	int isram;
+
+	/* once something can't be checked, every purge flushes anyway */
+	if (sh2->coderange_overflow)
+		return;
+
+	/* work in aligned chunks so neighbouring sequences merge */
+	start &= ~(CODE_RANGE_ALIGN - 1);
+	end |= CODE_RANGE_ALIGN - 1;
+	length = end + 1 - start;
+
+	/* skip it if it's already covered */
+	for (index = 0; index < sh2->coderange_count; index++)
+		if (start >= sh2->coderange[index].start && end <= sh2->coderange[index].end)
+			return;
+
+	/* RAM gets a shadow copy; ROM only has to stay mapped at the same place */
+	base = (const UINT8 *)memory_get_range_ptr(sh2->program, start, end);
+	isram = (base != NULL);
+	if (!isram && memory_get_write_ptr(sh2->program, start) == NULL && memory_get_write_ptr(sh2->program, end) == NULL)
+	{
+		base = (const UINT8 *)memory_get_read_ptr(sh2->program, start);
+		if (base != NULL && memory_get_read_ptr(sh2->program, end) != base + (end - start))
+			base = NULL;
+	}
+
+	/* extend the last range if this one continues it in RAM */
+	if (isram && sh2->coderange_count > 0)
+	{
+		range = &sh2->coderange[sh2->coderange_count - 1];
+		if (range->shadow != NULL && start >= range->start && start <= range->end + 1 && end > range->end &&
+			base == range->base + (start - range->start) &&
+			sh2->codeshadow_used + (end - range->end) <= CODE_SHADOW_SIZE)
+		{
+			memcpy(range->shadow + (range->end + 1 - range->start), base + (range->end + 1 - start), end - range->end);
+			sh2->codeshadow_used += end - range->end;
+			range->end = end;
+			return;
+		}
+	}
+
+	/* give up on tracking if we're out of space or the code isn't in plain memory */
+	if (base == NULL || sh2->coderange_count >= MAX_CODE_RANGES || (isram && sh2->codeshadow_used + length > CODE_SHADOW_SIZE))
+	{
+		sh2->coderange_overflow = TRUE;
+		return;
+	}
+
+	range = &sh2->coderange[sh2->coderange_count++];
+	range->start = start;
+	range->end = end;
+	range->base = base;
+	range->shadow = NULL;
+	if (isram)
+	{
+		range->shadow = &sh2->codeshadow[sh2->codeshadow_used];
+		memcpy(range->shadow, base, length);
+		sh2->codeshadow_used += length;
+	}
+}
+
+
+/*-------------------------------------------------
+    code_ranges_changed - return TRUE if any
+    memory translated code came from has been
+    modified or remapped since it was compiled
+-------------------------------------------------*/
+
+static int code_ranges_changed(SH2 *sh2)
+{
+	UINT32 index;
+
+	if (sh2->coderange_overflow)
+		return TRUE;
+
+	for (index = 0; index < sh2->coderange_count; index++)
+	{
+		const sh2_code_range *range = &sh2->coderange[index];
+
+		if (memory_get_read_ptr(sh2->program, range->start) != range->base)
+			return TRUE;
+		if (range->shadow != NULL && memcmp(range->shadow, range->base, range->end + 1 - range->start) != 0)
+			return TRUE;
+	}
+	return FALSE;
+}
+
 /* Execute cycles - returns number of cycles actually run */
 static CPU_EXECUTE( sh2 )
 {
@@ -885,14 +999,22 @@ static CPU_EXECUTE( sh2 )
 	drcuml_state *drcuml = sh2->drcuml;
 	int execute_result;
 
-	/* reset the cache if dirty */
-	if (sh2->cache_dirty)
-		code_flush_cache(sh2);
-
 	/* execute */
 	sh2->icount = cycles;
 	do
 	{
+		/* on a cache purge, only drop the translated code if its memory changed */
+		if (sh2->cache_purge)
+		{
+			sh2->cache_purge = FALSE;
+			if (code_ranges_changed(sh2))
+				sh2->cache_dirty = TRUE;
+		}
+
+		/* reset the cache if dirty */
+		if (sh2->cache_dirty)
+			code_flush_cache(sh2);
+
 		/* run as much as we can */
 		execute_result = drcuml_execute(drcuml, sh2->entry);
 
@@ -983,6 +1105,9 @@ static void code_compile_block(SH2 *sh2, UINT8 mode, offs_t pc)
 		if (memory_get_write_ptr(sh2->program, seqhead->physpc) != NULL)
 			generate_checksum_block(sh2, block, &compiler, seqhead, seqlast);
 
+		/* remember where this sequence came from for cache purges */
+		code_range_record(sh2, seqhead->physpc, seqlast->physpc + (seqlast->skipslots + 1) * 2 - 1);
+
 		/* label this instruction, if it may be jumped to locally */
 		if (seqhead->flags & OPFLAG_IS_BRANCH_TARGET)
 		{
@@ -228,6 +228,106 @@ static UINT16 dummy_shiftreg_r(const address_space *space, offs_t offset)
 
 
 
+/* Direct VRAM access for the bulk pixel ops; a row that is entirely backed
+   by RAM is accessed through a pointer, a row that the driver's
+   vram_read_row/vram_write_row hooks accept is copied into a buffer up front
+   and the words written are handed back when the row is done; anything else
+   (other I/O-mapped memory, shift register transfers, rows crossing a region
+   boundary) goes through the memory system exactly as before */
+#define VRAM_ROW_BUFFER_WORDS	1024
+
+typedef struct _vram_row vram_row;
+struct _vram_row
+{
+	UINT16 *	base;		/* pointer to the first word, or NULL if not directly accessible */
+	UINT32		first;		/* word address of the first word */
+	UINT32		count;		/* number of words covered */
+	UINT8		buffered;	/* base points to buffer, which must be written back */
+	UINT32		dirtymin;	/* first buffered word written */
+	UINT32		dirtymax;	/* last buffered word written */
+	UINT16		buffer[VRAM_ROW_BUFFER_WORDS];
+};
+
+static void vram_row_init(tms34010_state *tms, vram_row *row, UINT32 firstword, UINT32 count)
+{
+	const address_space *space = tms->program;
+	offs_t start = (firstword << 1) & space->bytemask;
+	offs_t end = start + ((count - 1) << 1);
+
+	row->base = NULL;
+	row->first = firstword;
+	row->count = count;
+	row->buffered = FALSE;
+	row->dirtymin = ~0;
+	row->dirtymax = 0;
+
+	/* shift register transfers must always go through the handlers */
+	if (IOREG(tms, REG_DPYCTL) & 0x0800)
+		return;
+
+	/* every byte of the row must be read and written as the same RAM */
+	row->base = (UINT16 *)memory_get_range_ptr(space, start, end + 1);
+	if (row->base != NULL)
+		return;
+
+	/* otherwise let the driver supply it */
+	if (tms->config->vram_read_row != NULL && count <= VRAM_ROW_BUFFER_WORDS &&
+		(*tms->config->vram_read_row)(space, start, row->buffer, count))
+	{
+		row->base = row->buffer;
+		row->buffered = TRUE;
+	}
+}
+
+static void vram_row_separate(vram_row *srcrow, vram_row *dstrow)
+{
+	/* a buffered source would not see writes to a buffered destination that overlaps it */
+	if ((srcrow->buffered || dstrow->buffered) &&
+		srcrow->first < dstrow->first + dstrow->count && dstrow->first < srcrow->first + srcrow->count)
+	{
+		if (srcrow->buffered)
+			srcrow->base = NULL, srcrow->buffered = FALSE;
+		if (dstrow->buffered)
+			dstrow->base = NULL, dstrow->buffered = FALSE;
+	}
+}
+
+INLINE void vram_row_mark_dirty(vram_row *row, UINT32 index, UINT32 count)
+{
+	if (index < row->dirtymin)
+		row->dirtymin = index;
+	if (index + count - 1 > row->dirtymax)
+		row->dirtymax = index + count - 1;
+}
+
+static void vram_row_flush(tms34010_state *tms, vram_row *row)
+{
+	if (row->buffered && row->dirtymin <= row->dirtymax)
+		(*tms->config->vram_write_row)(tms->program, (row->first + row->dirtymin) << 1, &row->buffer[row->dirtymin], row->dirtymax - row->dirtymin + 1);
+}
+
+INLINE UINT16 vram_row_read(tms34010_state *tms, const vram_row *row, UINT16 (*word_read)(const address_space *, offs_t), UINT32 wordaddr)
+{
+	UINT32 index = wordaddr - row->first;
+	if (row->base != NULL && index < row->count)
+		return row->base[index];
+	return (*word_read)(tms->program, wordaddr << 1);
+}
+
+INLINE void vram_row_write(tms34010_state *tms, vram_row *row, void (*word_write)(const address_space *, offs_t, UINT16), UINT32 wordaddr, UINT16 data)
+{
+	UINT32 index = wordaddr - row->first;
+	if (row->base != NULL && index < row->count)
+	{
+		row->base[index] = data;
+		vram_row_mark_dirty(row, index, 1);
+	}
+	else
+		(*word_write)(tms->program, wordaddr << 1, data);
+}
+
+
+
 /* Pixel operations */
 static UINT32 pixel_op00(UINT32 dstpix, UINT32 mask, UINT32 srcpix) { return srcpix; }
 static UINT32 pixel_op01(UINT32 dstpix, UINT32 mask, UINT32 srcpix) { return srcpix & dstpix; }
@@ -1101,15 +1201,21 @@ static void FUNCTION_NAME(pixblt)(tms34010_state *tms, int src_is_linear, int ds
 			UINT8 srcbit = saddr & 15;
 			UINT8 dstbit = daddr & 15;
 			UINT32 srcword, dstword = 0;
+			vram_row srcrow, dstrow;
+
+			/* look up direct pointers to this row */
+			vram_row_init(tms, &srcrow, srcwordaddr, (srcbit + dx * BITS_PER_PIXEL) / 16 + 2);
+			vram_row_init(tms, &dstrow, dstwordaddr, (dstbit + dx * BITS_PER_PIXEL) / 16 + 2);
+			vram_row_separate(&srcrow, &dstrow);
 
 			/* fetch the initial source word */
-			srcword = (*word_read)(tms->program, srcwordaddr++ << 1);
+			srcword = vram_row_read(tms, &srcrow, word_read, srcwordaddr++);
 			readwrites++;
 
 			/* fetch the initial dest word */
 			if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY || (daddr & 0x0f) != 0)
 			{
-				dstword = (*word_read)(tms->program, dstwordaddr << 1);
+				dstword = vram_row_read(tms, &dstrow, word_read, dstwordaddr);
 				readwrites++;
 			}
 
@@ -1122,7 +1228,7 @@ static void FUNCTION_NAME(pixblt)(tms34010_state *tms, int src_is_linear, int ds
 				/* fetch more words if necessary */
 				if (srcbit + BITS_PER_PIXEL > 16)
 				{
-					srcword |= (*word_read)(tms->program, srcwordaddr++ << 1) << 16;
+					srcword |= vram_row_read(tms, &srcrow, word_read, srcwordaddr++) << 16;
 					readwrites++;
 				}
 
@@ -1139,7 +1245,7 @@ static void FUNCTION_NAME(pixblt)(tms34010_state *tms, int src_is_linear, int ds
 				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
 					if (dstbit + BITS_PER_PIXEL > 16)
 					{
-						dstword |= (*word_read)(tms->program, (dstwordaddr + 1) << 1) << 16;
+						dstword |= vram_row_read(tms, &dstrow, word_read, dstwordaddr + 1) << 16;
 						readwrites++;
 					}
 
@@ -1154,7 +1260,7 @@ static void FUNCTION_NAME(pixblt)(tms34010_state *tms, int src_is_linear, int ds
 				dstbit += BITS_PER_PIXEL;
 				if (dstbit > 16)
 				{
-					(*word_write)(tms->program, dstwordaddr++ << 1, dstword);
+					vram_row_write(tms, &dstrow, word_write, dstwordaddr++, dstword);
 					readwrites++;
 					dstbit -= 16;
 					dstword >>= 16;
@@ -1167,13 +1273,13 @@ static void FUNCTION_NAME(pixblt)(tms34010_state *tms, int src_is_linear, int ds
 				/* if we're right-partial, read and mask the remaining bits */
 				if (dstbit != 16)
 				{
-					UINT16 origdst = (*word_read)(tms->program, dstwordaddr << 1);
+					UINT16 origdst = vram_row_read(tms, &dstrow, word_read, dstwordaddr);
 					UINT16 mask = 0xffff << dstbit;
 					dstword = (dstword & ~mask) | (origdst & mask);
 					readwrites++;
 				}
 
-				(*word_write)(tms->program, dstwordaddr++ << 1, dstword);
+				vram_row_write(tms, &dstrow, word_write, dstwordaddr++, dstword);
 				readwrites++;
 			}
 
@@ -1327,6 +1433,9 @@ static void FUNCTION_NAME(pixblt)(tms34010_state *tms, int src_is_linear, int ds
 			}
 #endif
 
+			/* hand back any buffered words */
+			vram_row_flush(tms, &dstrow);
+
 			/* update for next row */
 			if (!yreverse)
 			{
@@ -1452,6 +1561,7 @@ if ((daddr & (BITS_PER_PIXEL - 1)) != 0) mame_printf_debug("PIXBLT_R%d with odd
 			int left_partials, right_partials, full_words, bitshift, bitshift_alt;
 			UINT16 srcword, srcmask, dstword, dstmask, pixel;
 			UINT32 swordaddr, dwordaddr;
+			vram_row srcrow, dstrow;
 
 			/* determine the bit shift to get from source to dest */
 			bitshift = ((daddr & 15) - (saddr & 15)) & 15;
@@ -1473,15 +1583,20 @@ if ((daddr & (BITS_PER_PIXEL - 1)) != 0) mame_printf_debug("PIXBLT_R%d with odd
 			swordaddr = (saddr + 15) >> 4;
 			dwordaddr = (daddr + 15) >> 4;
 
+			/* look up direct pointers to this row */
+			vram_row_init(tms, &srcrow, ((saddr - dx * BITS_PER_PIXEL) >> 4) - 1, swordaddr - ((saddr - dx * BITS_PER_PIXEL) >> 4) + 2);
+			vram_row_init(tms, &dstrow, ((daddr - dx * BITS_PER_PIXEL) >> 4) - 1, dwordaddr - ((daddr - dx * BITS_PER_PIXEL) >> 4) + 2);
+			vram_row_separate(&srcrow, &dstrow);
+
 			/* fetch the initial source word */
-			srcword = (*word_read)(tms->program, --swordaddr << 1);
+			srcword = vram_row_read(tms, &srcrow, word_read, --swordaddr);
 			srcmask = PIXEL_MASK << ((saddr - BITS_PER_PIXEL) & 15);
 
 			/* handle the right partial word */
 			if (right_partials != 0)
 			{
 				/* fetch the destination word */
-				dstword = (*word_read)(tms->program, --dwordaddr << 1);
+				dstword = vram_row_read(tms, &dstrow, word_read, --dwordaddr);
 				dstmask = PIXEL_MASK << ((daddr - BITS_PER_PIXEL) & 15);
 
 				/* loop over partials */
@@ -1490,7 +1605,7 @@ if ((daddr & (BITS_PER_PIXEL - 1)) != 0) mame_printf_debug("PIXBLT_R%d with odd
 					/* fetch source pixel if necessary */
 					if (srcmask == 0)
 					{
-						srcword = (*word_read)(tms->program, --swordaddr << 1);
+						srcword = vram_row_read(tms, &srcrow, word_read, --swordaddr);
 						srcmask = PIXEL_MASK << (16 - BITS_PER_PIXEL);
 					}
 
@@ -1512,7 +1627,7 @@ if ((daddr & (BITS_PER_PIXEL - 1)) != 0) mame_printf_debug("PIXBLT_R%d with odd
 				}
 
 				/* write the result */
-				(*word_write)(tms->program, dwordaddr << 1, dstword);
+				vram_row_write(tms, &dstrow, word_write, dwordaddr, dstword);
 			}
 
 			/* loop over full words */
@@ -1521,7 +1636,7 @@ if ((daddr & (BITS_PER_PIXEL - 1)) != 0) mame_printf_debug("PIXBLT_R%d with odd
 				/* fetch the destination word (if necessary) */
 				dwordaddr--;
 				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
-					dstword = (*word_read)(tms->program, dwordaddr << 1);
+					dstword = vram_row_read(tms, &dstrow, word_read, dwordaddr);
 				else
 					dstword = 0;
 				dstmask = PIXEL_MASK << (16 - BITS_PER_PIXEL);
@@ -1532,7 +1647,7 @@ if ((daddr & (BITS_PER_PIXEL - 1)) != 0) mame_printf_debug("PIXBLT_R%d with odd
 					/* fetch source pixel if necessary */
 					if (srcmask == 0)
 					{
-						srcword = (*word_read)(tms->program, --swordaddr << 1);
+						srcword = vram_row_read(tms, &srcrow, word_read, --swordaddr);
 						srcmask = PIXEL_MASK << (16 - BITS_PER_PIXEL);
 					}
 
@@ -1554,14 +1669,14 @@ if ((daddr & (BITS_PER_PIXEL - 1)) != 0) mame_printf_debug("PIXBLT_R%d with odd
 				}
 
 				/* write the result */
-				(*word_write)(tms->program, dwordaddr << 1, dstword);
+				vram_row_write(tms, &dstrow, word_write, dwordaddr, dstword);
 			}
 
 			/* handle the left partial word */
 			if (left_partials != 0)
 			{
 				/* fetch the destination word */
-				dstword = (*word_read)(tms->program, --dwordaddr << 1);
+				dstword = vram_row_read(tms, &dstrow, word_read, --dwordaddr);
 				dstmask = PIXEL_MASK << (16 - BITS_PER_PIXEL);
 
 				/* loop over partials */
@@ -1570,7 +1685,7 @@ if ((daddr & (BITS_PER_PIXEL - 1)) != 0) mame_printf_debug("PIXBLT_R%d with odd
 					/* fetch the source pixel if necessary */
 					if (srcmask == 0)
 					{
-						srcword = (*word_read)(tms->program, --swordaddr << 1);
+						srcword = vram_row_read(tms, &srcrow, word_read, --swordaddr);
 						srcmask = PIXEL_MASK << (16 - BITS_PER_PIXEL);
 					}
 
@@ -1592,9 +1707,12 @@ if ((daddr & (BITS_PER_PIXEL - 1)) != 0) mame_printf_debug("PIXBLT_R%d with odd
 				}
 
 				/* write the result */
-				(*word_write)(tms->program, dwordaddr << 1, dstword);
+				vram_row_write(tms, &dstrow, word_write, dwordaddr, dstword);
 			}
 
+			/* hand back any buffered words */
+			vram_row_flush(tms, &dstrow);
+
 			/* update for next row */
 			if (!yreverse)
 			{
@@ -1711,20 +1829,26 @@ static void FUNCTION_NAME(pixblt_b)(tms34010_state *tms, int dst_is_linear)
 		{
 			UINT16 srcword, srcmask, dstword, dstmask, pixel;
 			UINT32 swordaddr, dwordaddr;
+			vram_row srcrow, dstrow;
 
 			/* use byte addresses each row */
 			swordaddr = saddr >> 4;
 			dwordaddr = daddr >> 4;
 
+			/* look up direct pointers to this row */
+			vram_row_init(tms, &srcrow, swordaddr, ((saddr & 15) + dx) / 16 + 2);
+			vram_row_init(tms, &dstrow, dwordaddr, ((daddr & 15) + dx * BITS_PER_PIXEL) / 16 + 2);
+			vram_row_separate(&srcrow, &dstrow);
+
 			/* fetch the initial source word */
-			srcword = (*word_read)(tms->program, swordaddr++ << 1);
+			srcword = vram_row_read(tms, &srcrow, word_read, swordaddr++);
 			srcmask = 1 << (saddr & 15);
 
 			/* handle the left partial word */
 			if (left_partials != 0)
 			{
 				/* fetch the destination word */
-				dstword = (*word_read)(tms->program, dwordaddr << 1);
+				dstword = vram_row_read(tms, &dstrow, word_read, dwordaddr);
 				dstmask = PIXEL_MASK << (daddr & 15);
 
 				/* loop over partials */
@@ -1741,7 +1865,7 @@ static void FUNCTION_NAME(pixblt_b)(tms34010_state *tms, int dst_is_linear)
 					srcmask <<= 1;
 					if (srcmask == 0)
 					{
-						srcword = (*word_read)(tms->program, swordaddr++ << 1);
+						srcword = vram_row_read(tms, &srcrow, word_read, swordaddr++);
 						srcmask = 0x0001;
 					}
 
@@ -1750,7 +1874,7 @@ static void FUNCTION_NAME(pixblt_b)(tms34010_state *tms, int dst_is_linear)
 				}
 
 				/* write the result */
-				(*word_write)(tms->program, dwordaddr++ << 1, dstword);
+				vram_row_write(tms, &dstrow, word_write, dwordaddr++, dstword);
 			}
 
 			/* loop over full words */
@@ -1758,7 +1882,7 @@ static void FUNCTION_NAME(pixblt_b)(tms34010_state *tms, int dst_is_linear)
 			{
 				/* fetch the destination word (if necessary) */
 				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
-					dstword = (*word_read)(tms->program, dwordaddr << 1);
+					dstword = vram_row_read(tms, &dstrow, word_read, dwordaddr);
 				else
 					dstword = 0;
 				dstmask = PIXEL_MASK;
@@ -1777,7 +1901,7 @@ static void FUNCTION_NAME(pixblt_b)(tms34010_state *tms, int dst_is_linear)
 					srcmask <<= 1;
 					if (srcmask == 0)
 					{
-						srcword = (*word_read)(tms->program, swordaddr++ << 1);
+						srcword = vram_row_read(tms, &srcrow, word_read, swordaddr++);
 						srcmask = 0x0001;
 					}
 
@@ -1786,14 +1910,14 @@ static void FUNCTION_NAME(pixblt_b)(tms34010_state *tms, int dst_is_linear)
 				}
 
 				/* write the result */
-				(*word_write)(tms->program, dwordaddr++ << 1, dstword);
+				vram_row_write(tms, &dstrow, word_write, dwordaddr++, dstword);
 			}
 
 			/* handle the right partial word */
 			if (right_partials != 0)
 			{
 				/* fetch the destination word */
-				dstword = (*word_read)(tms->program, dwordaddr << 1);
+				dstword = vram_row_read(tms, &dstrow, word_read, dwordaddr);
 				dstmask = PIXEL_MASK;
 
 				/* loop over partials */
@@ -1810,7 +1934,7 @@ static void FUNCTION_NAME(pixblt_b)(tms34010_state *tms, int dst_is_linear)
 					srcmask <<= 1;
 					if (srcmask == 0)
 					{
-						srcword = (*word_read)(tms->program, swordaddr++ << 1);
+						srcword = vram_row_read(tms, &srcrow, word_read, swordaddr++);
 						srcmask = 0x0001;
 					}
 
@@ -1819,9 +1943,12 @@ static void FUNCTION_NAME(pixblt_b)(tms34010_state *tms, int dst_is_linear)
 				}
 
 				/* write the result */
-				(*word_write)(tms->program, dwordaddr++ << 1, dstword);
+				vram_row_write(tms, &dstrow, word_write, dwordaddr++, dstword);
 			}
 
+			/* hand back any buffered words */
+			vram_row_flush(tms, &dstrow);
+
 			/* update for next row */
 			saddr += SPTCH(tms);
 			daddr += DPTCH(tms);
@@ -1922,10 +2049,15 @@ static void FUNCTION_NAME(fill)(tms34010_state *tms, int dst_is_linear)
 		{
 			UINT16 dstword, dstmask, pixel;
 			UINT32 dwordaddr;
+			vram_row dstrow;
+			int full_words_done;
 
 			/* use byte addresses each row */
 			dwordaddr = daddr >> 4;
 
+			/* look up a direct pointer to this row */
+			vram_row_init(tms, &dstrow, dwordaddr, ((daddr & 15) + dx * BITS_PER_PIXEL) / 16 + 2);
+
 			/* compute cycles */
 			tms->gfxcycles += compute_fill_cycles(left_partials, right_partials, full_words, PIXEL_OP_TIMING);
 
@@ -1933,7 +2065,7 @@ static void FUNCTION_NAME(fill)(tms34010_state *tms, int dst_is_linear)
 			if (left_partials != 0)
 			{
 				/* fetch the destination word */
-				dstword = (*word_read)(tms->program, dwordaddr << 1);
+				dstword = vram_row_read(tms, &dstrow, word_read, dwordaddr);
 				dstmask = PIXEL_MASK << (daddr & 15);
 
 				/* loop over partials */
@@ -1950,15 +2082,31 @@ static void FUNCTION_NAME(fill)(tms34010_state *tms, int dst_is_linear)
 				}
 
 				/* write the result */
-				(*word_write)(tms->program, dwordaddr++ << 1, dstword);
+				vram_row_write(tms, &dstrow, word_write, dwordaddr++, dstword);
+			}
+
+			/* opaque replace fills of directly accessible rows are plain word stores */
+			if (!PIXEL_OP_REQUIRES_SOURCE && !TRANSPARENCY && dstrow.base != NULL && dwordaddr - dstrow.first + full_words <= dstrow.count)
+			{
+				UINT16 *dest = &dstrow.base[dwordaddr - dstrow.first];
+				UINT16 color = COLOR1(tms);
+
+				for (words = 0; words < full_words; words++)
+					dest[words] = color;
+				if (full_words > 0)
+					vram_row_mark_dirty(&dstrow, dwordaddr - dstrow.first, full_words);
+				dwordaddr += full_words;
+				full_words_done = full_words;
 			}
+			else
+				full_words_done = 0;
 
 			/* loop over full words */
-			for (words = 0; words < full_words; words++)
+			for (words = full_words_done; words < full_words; words++)
 			{
 				/* fetch the destination word (if necessary) */
 				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
-					dstword = (*word_read)(tms->program, dwordaddr << 1);
+					dstword = vram_row_read(tms, &dstrow, word_read, dwordaddr);
 				else
 					dstword = 0;
 				dstmask = PIXEL_MASK;
@@ -1977,14 +2125,14 @@ static void FUNCTION_NAME(fill)(tms34010_state *tms, int dst_is_linear)
 				}
 
 				/* write the result */
-				(*word_write)(tms->program, dwordaddr++ << 1, dstword);
+				vram_row_write(tms, &dstrow, word_write, dwordaddr++, dstword);
 			}
 
 			/* handle the right partial word */
 			if (right_partials != 0)
 			{
 				/* fetch the destination word */
-				dstword = (*word_read)(tms->program, dwordaddr << 1);
+				dstword = vram_row_read(tms, &dstrow, word_read, dwordaddr);
 				dstmask = PIXEL_MASK;
 
 				/* loop over partials */
@@ -2001,9 +2149,12 @@ static void FUNCTION_NAME(fill)(tms34010_state *tms, int dst_is_linear)
 				}
 
 				/* write the result */
-				(*word_write)(tms->program, dwordaddr++ << 1, dstword);
+				vram_row_write(tms, &dstrow, word_write, dwordaddr++, dstword);
 			}
 
+			/* hand back any buffered words */
+			vram_row_flush(tms, &dstrow);
+
 			/* update for next row */
 			daddr += DPTCH(tms);
 		}
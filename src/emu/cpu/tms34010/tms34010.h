@@ -203,6 +203,8 @@ struct _tms34010_config
 	void	(*output_int)(const device_config *device, int state);			/* output interrupt callback */
 	void	(*to_shiftreg)(const address_space *space, offs_t, UINT16 *);	/* shift register write */
 	void	(*from_shiftreg)(const address_space *space, offs_t, UINT16 *);	/* shift register read */
+	int		(*vram_read_row)(const address_space *space, offs_t, UINT16 *, UINT32);		/* bulk VRAM read for PIXBLT/FILL, FALSE if not VRAM */
+	void	(*vram_write_row)(const address_space *space, offs_t, const UINT16 *, UINT32);	/* bulk VRAM write for PIXBLT/FILL */
 };
 
 
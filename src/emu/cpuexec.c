@@ -38,6 +38,11 @@ enum
 	TRIGGER_SUSPENDTIME = -4000
 };
 
+/* PC sampling profiler */
+#define PCPROFILE_HASH_SIZE		4096		/* number of hash buckets per CPU */
+#define PCPROFILE_MAX_ENTRIES	32768		/* maximum number of distinct PCs tracked per CPU */
+#define PCPROFILE_REPORT_LINES	100			/* number of PCs reported per CPU */
+
 
 
 /***************************************************************************
@@ -56,6 +61,30 @@ struct _cpu_input_data
 };
 
 
+/* a single PC histogram entry */
+typedef struct _cpu_pc_sample cpu_pc_sample;
+struct _cpu_pc_sample
+{
+	cpu_pc_sample *	next;					/* next entry in the same hash bucket */
+	offs_t			pc;						/* sampled PC */
+	UINT32			hits;					/* number of samples taken at this PC */
+	UINT64			cycles;					/* number of cycles attributed to this PC */
+};
+
+
+/* PC histogram for one CPU */
+typedef struct _cpu_pc_profile cpu_pc_profile;
+struct _cpu_pc_profile
+{
+	cpu_pc_sample *	hash[PCPROFILE_HASH_SIZE]; /* hash table of entries */
+	cpu_pc_sample *	entry;					/* preallocated pool of entries */
+	int				entries;				/* number of entries used from the pool */
+	UINT32			samples;				/* total number of samples taken */
+	UINT32			dropped;				/* samples dropped because the pool was full */
+	UINT64			cycles;					/* total number of cycles sampled */
+};
+
+
 /* internal data hanging off of the classtoken */
 typedef struct _cpu_class_data cpu_class_data;
 struct _cpu_class_data
@@ -102,6 +131,9 @@ struct _cpu_class_data
 	INT32 			iloops; 				/* number of interrupts remaining this frame */
 	emu_timer *		partial_frame_timer;	/* the timer that triggers partial frame interrupts */
 	attotime		partial_frame_period;	/* the length of one partial frame for interrupt purposes */
+
+	/* PC sampling profiler */
+	cpu_pc_profile *pcprofile;				/* PC histogram, or NULL if not profiling */
 };
 
 
@@ -112,6 +144,7 @@ struct _cpuexec_private
 	const device_config *executingcpu;		/* pointer to the currently executing CPU */
 	cpu_class_data *executelist;			/* execution list; suspended CPUs are at the back */
 	char			statebuf[256];			/* string buffer containing state description */
+	mame_file *		pcprofile_file;			/* PC sampling profiler report file */
 };
 
 
@@ -132,6 +165,9 @@ static TIMER_CALLBACK( empty_event_queue );
 static IRQ_CALLBACK( standard_irq_callback );
 static void register_save_states(const device_config *device);
 static void rebuild_execute_list(running_machine *machine);
+static void cpuexec_exit(running_machine *machine);
+static void pcprofile_sample(cpu_pc_profile *profile, offs_t pc, int cycles);
+static void pcprofile_report(const device_config *device);
 static UINT64 get_register_value(const device_config *device, void *baseptr, const cpu_state_entry *entry);
 static void set_register_value(const device_config *device, void *baseptr, const cpu_state_entry *entry, UINT64 value);
 static void get_register_string_value(const device_config *device, void *baseptr, const cpu_state_entry *entry, char *dest);
@@ -247,6 +283,22 @@ void cpuexec_init(running_machine *machine)
 
 	/* register callbacks */
 	config_register(machine, "cpu", cpu_load, cpu_save);
+	add_exit_callback(machine, cpuexec_exit);
+}
+
+
+/*-------------------------------------------------
+    cpuexec_exit - clean up after ourselves
+-------------------------------------------------*/
+
+static void cpuexec_exit(running_machine *machine)
+{
+	cpuexec_private *global = machine->cpuexec_data;
+
+	/* close the PC profiler report; the CPUs have written to it as they stopped */
+	if (global->pcprofile_file != NULL)
+		mame_fclose(global->pcprofile_file);
+	global->pcprofile_file = NULL;
 }
 
 
@@ -344,6 +396,10 @@ void cpuexec_timeslice(running_machine *machine)
 						assert(ran >= classdata->cycles_stolen);
 						ran -= classdata->cycles_stolen;
 						profiler_mark_end();
+
+						/* sample the PC where this slice ended */
+						if (classdata->pcprofile != NULL)
+							pcprofile_sample(classdata->pcprofile, cpu_get_pc(classdata->device), ran);
 					}
 
 					/* account for these cycles */
@@ -578,6 +634,13 @@ static DEVICE_START( cpu )
 	classdata->clock = (UINT64)device->clock * cpu_get_clock_multiplier(device) / cpu_get_clock_divider(device);
 	classdata->clockscale = 1.0;
 
+	/* allocate the PC histogram if we are profiling */
+	if (options_get_bool(mame_options(), OPTION_CPUPROFILE))
+	{
+		classdata->pcprofile = auto_alloc_clear(device->machine, cpu_pc_profile);
+		classdata->pcprofile->entry = auto_alloc_array_clear(device->machine, cpu_pc_sample, PCPROFILE_MAX_ENTRIES);
+	}
+
 	/* allocate timers if we need them */
 	if (config->vblank_interrupts_per_frame > 1)
 		classdata->partial_frame_timer = timer_alloc(device->machine, trigger_partial_frame_interrupt, (void *)device);
@@ -700,8 +763,13 @@ static DEVICE_RESET( cpu )
 
 static DEVICE_STOP( cpu )
 {
+	cpu_class_data *classdata = get_class_data(device);
 	cpu_exit_func exit;
 
+	/* write out the PC histogram while the CPU is still intact */
+	if (classdata->pcprofile != NULL)
+		pcprofile_report(device);
+
 	/* call the CPU's exit function if present */
 	exit = (cpu_exit_func)device_get_info_fct(device, CPUINFO_FCT_EXIT);
 	if (exit != NULL)
@@ -1356,6 +1424,154 @@ int cpu_getiloops(const device_config *device)
 
 
 
+/***************************************************************************
+    PC SAMPLING PROFILER
+***************************************************************************/
+
+/*-------------------------------------------------
+    pcprofile_sample - record a PC sample,
+    weighted by the number of cycles executed
+-------------------------------------------------*/
+
+static void pcprofile_sample(cpu_pc_profile *profile, offs_t pc, int cycles)
+{
+	cpu_pc_sample **bucket = &profile->hash[(pc ^ (pc >> 12)) % PCPROFILE_HASH_SIZE];
+	cpu_pc_sample *sample;
+
+	profile->samples++;
+	profile->cycles += cycles;
+
+	/* look for an existing entry */
+	for (sample = *bucket; sample != NULL; sample = sample->next)
+		if (sample->pc == pc)
+			break;
+
+	/* if not found, allocate a new one from the pool */
+	if (sample == NULL)
+	{
+		if (profile->entries >= PCPROFILE_MAX_ENTRIES)
+		{
+			profile->dropped++;
+			return;
+		}
+		sample = &profile->entry[profile->entries++];
+		sample->pc = pc;
+		sample->next = *bucket;
+		*bucket = sample;
+	}
+
+	sample->hits++;
+	sample->cycles += cycles;
+}
+
+
+/*-------------------------------------------------
+    pcprofile_compare - qsort callback to sort
+    samples by decreasing cycle count
+-------------------------------------------------*/
+
+static int pcprofile_compare(const void *item1, const void *item2)
+{
+	const cpu_pc_sample *sample1 = *(const cpu_pc_sample * const *)item1;
+	const cpu_pc_sample *sample2 = *(const cpu_pc_sample * const *)item2;
+
+	if (sample1->cycles != sample2->cycles)
+		return (sample1->cycles < sample2->cycles) ? 1 : -1;
+	return (sample1->pc < sample2->pc) ? -1 : (sample1->pc > sample2->pc);
+}
+
+
+/*-------------------------------------------------
+    pcprofile_disassemble - disassemble a single
+    instruction for the report
+-------------------------------------------------*/
+
+static void pcprofile_disassemble(const device_config *device, char *buffer, offs_t pc)
+{
+	const address_space *space = cpu_get_address_space(device, ADDRESS_SPACE_PROGRAM);
+	cpu_disassemble_func disassemble;
+	UINT8 opbuf[64], argbuf[64];
+	int maxbytes, numbytes;
+	offs_t pcbyte;
+
+	/* if the debugger is running, let it handle overrides and address translation */
+	if ((device->machine->debug_flags & DEBUG_FLAG_ENABLED) != 0)
+	{
+		debug_cpu_disassemble_at(device, buffer, pc);
+		return;
+	}
+
+	/* otherwise, go directly to the CPU's disassembler */
+	disassemble = (cpu_disassemble_func)device_get_info_fct(device, CPUINFO_FCT_DISASSEMBLE);
+	if (disassemble == NULL || space == NULL)
+	{
+		strcpy(buffer, "???");
+		return;
+	}
+
+	/* fetch the bytes up to the maximum */
+	maxbytes = MIN(cpu_get_max_opcode_bytes(device), ARRAY_LENGTH(opbuf));
+	pcbyte = memory_address_to_byte(space, pc) & space->bytemask;
+	for (numbytes = 0; numbytes < maxbytes; numbytes++)
+	{
+		opbuf[numbytes] = memory_decrypted_read_byte(space, pcbyte + numbytes);
+		argbuf[numbytes] = memory_raw_read_byte(space, pcbyte + numbytes);
+	}
+	(*disassemble)(device, buffer, pc, opbuf, argbuf, 0);
+}
+
+
+/*-------------------------------------------------
+    pcprofile_report - append the PC histogram
+    of a CPU to the report file
+-------------------------------------------------*/
+
+static void pcprofile_report(const device_config *device)
+{
+	cpuexec_private *global = device->machine->cpuexec_data;
+	cpu_pc_profile *profile = get_class_data(device)->pcprofile;
+	const address_space *space = cpu_get_address_space(device, ADDRESS_SPACE_PROGRAM);
+	cpu_pc_sample **sorted;
+	int entnum;
+
+	/* open the report file the first time through */
+	if (global->pcprofile_file == NULL)
+	{
+		file_error filerr = mame_fopen(SEARCHPATH_DEBUGLOG, "cpuprof.txt", OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, &global->pcprofile_file);
+		if (filerr != FILERR_NONE)
+			return;
+		mame_fprintf(global->pcprofile_file, "PC sampling profile for %s (%s)\n", device->machine->gamedrv->name, device->machine->gamedrv->description);
+	}
+
+	mame_fprintf(global->pcprofile_file, "\nCPU '%s' (%s): %u samples, %.0f cycles", device->tag, cpu_get_name(device), profile->samples, (double)profile->cycles);
+	if (profile->dropped != 0)
+		mame_fprintf(global->pcprofile_file, ", %u samples dropped", profile->dropped);
+	mame_fprintf(global->pcprofile_file, "\n");
+	if (profile->entries == 0 || profile->cycles == 0)
+		return;
+
+	/* sort the entries by cycle count */
+	sorted = alloc_array_or_die(cpu_pc_sample *, profile->entries);
+	for (entnum = 0; entnum < profile->entries; entnum++)
+		sorted[entnum] = &profile->entry[entnum];
+	qsort(sorted, profile->entries, sizeof(sorted[0]), pcprofile_compare);
+
+	/* output the hottest PCs along with their disassembly */
+	for (entnum = 0; entnum < profile->entries && entnum < PCPROFILE_REPORT_LINES; entnum++)
+	{
+		const cpu_pc_sample *sample = sorted[entnum];
+		char buffer[256];
+
+		pcprofile_disassemble(device, buffer, sample->pc);
+		mame_fprintf(global->pcprofile_file, "  %s  %6.2f%%  %10u  %s\n",
+				core_i64_hex_format(sample->pc, (space != NULL) ? space->logaddrchars : 8),
+				(double)sample->cycles * 100.0 / (double)profile->cycles, sample->hits, buffer);
+	}
+	free(sorted);
+}
+
+
+
 /***************************************************************************
     INTERNAL FUNCTIONS
 ***************************************************************************/
@@ -438,6 +438,18 @@ offs_t debug_cpu_disassemble(const device_config *device, char *buffer, offs_t p
 }
 
 
+/*-------------------------------------------------
+    debug_cpu_disassemble_at - disassemble a line
+    at a given PC on a given CPU, fetching the
+    opcode bytes through the debugger
+-------------------------------------------------*/
+
+offs_t debug_cpu_disassemble_at(const device_config *device, char *buffer, offs_t pc)
+{
+	return dasm_wrapped(device, buffer, pc);
+}
+
+
 /*-------------------------------------------------
     debug_cpu_set_dasm_override - set an override
     handler for disassembly
@@ -212,6 +212,9 @@ int debug_cpu_translate(const address_space *space, int intention, offs_t *addre
 /* disassemble a line at a given PC on a given CPU */
 offs_t debug_cpu_disassemble(const device_config *device, char *buffer, offs_t pc, const UINT8 *oprom, const UINT8 *opram);
 
+/* disassemble a line at a given PC, fetching the opcode bytes from memory */
+offs_t debug_cpu_disassemble_at(const device_config *device, char *buffer, offs_t pc);
+
 /* set an override handler for disassembly */
 void debug_cpu_set_dasm_override(const device_config *device, cpu_disassemble_func dasm_override);
 
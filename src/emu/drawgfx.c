@@ -14,6 +14,40 @@
 #include "deprecat.h"
 
 
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* marks a code with no cache slot */
+#define GFX_CACHE_NONE			0xffffffff
+
+/* cache pixel memory is allocated this many slots at a time */
+#define GFX_CACHE_CHUNK_SLOTS	256
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* bounded cache of decoded elements, recycled in least recently used order */
+struct _gfx_cache
+{
+	UINT32 *		code_slot;			/* slot holding each code, or GFX_CACHE_NONE */
+	UINT32 *		slot_code;			/* code held in each slot */
+	UINT32 *		slot_prev;			/* next more recently used slot */
+	UINT32 *		slot_next;			/* next less recently used slot */
+	UINT32 *		slot_frame;			/* frame in which each slot was last used */
+	UINT8 **		chunk;				/* pixel memory, GFX_CACHE_CHUNK_SLOTS slots per chunk */
+	UINT32			slots;				/* number of slots handed out so far */
+	UINT32			budget;				/* number of slots to fill before recycling */
+	UINT32			head;				/* most recently used slot */
+	UINT32			tail;				/* least recently used slot */
+	UINT32			frame;				/* current frame number */
+};
+
+
+
 /***************************************************************************
     GLOBAL VARIABLES
 ***************************************************************************/
@@ -28,6 +62,9 @@ UINT8 no_priority_size_is_wrong[2 * (sizeof(NO_PRIORITY) == 3) - 1];
 ***************************************************************************/
 
 void decodechar(const gfx_element *gfx, UINT32 code, const UINT8 *src);
+static gfx_cache *gfx_cache_alloc(const gfx_element *gfx, UINT32 budget);
+static void gfx_cache_free(gfx_cache *cache);
+static UINT8 *gfx_cache_get_slot(const gfx_element *gfx, UINT32 code);
 
 
 
@@ -46,6 +83,30 @@ INLINE int readbit(const UINT8 *src, unsigned int bitnum)
 }
 
 
+/*-------------------------------------------------
+    gfx_cache_slot_base - return a pointer to the
+    pixel memory for a cache slot
+-------------------------------------------------*/
+
+INLINE UINT8 *gfx_cache_slot_base(const gfx_element *gfx, UINT32 slot)
+{
+	return gfx->cache->chunk[slot / GFX_CACHE_CHUNK_SLOTS] + (slot % GFX_CACHE_CHUNK_SLOTS) * gfx->char_modulo;
+}
+
+
+/*-------------------------------------------------
+    element_base - return a pointer to the start
+    of a code's pixels, ignoring source clipping
+-------------------------------------------------*/
+
+INLINE UINT8 *element_base(const gfx_element *gfx, UINT32 code)
+{
+	if (gfx->cache != NULL)
+		return gfx_cache_get_slot(gfx, code);
+	return gfx->gfxdata + code * gfx->char_modulo;
+}
+
+
 /*-------------------------------------------------
     normalize_xscroll - normalize an X scroll
     value for a bitmap to be positive and less
@@ -167,12 +228,19 @@ gfx_element *gfx_element_alloc(running_machine *machine, const gfx_layout *gl, c
 	/* decoded graphics case */
 	else
 	{
+		UINT64 cachebytes = (UINT64)options_get_int(mame_options(), OPTION_GFXCACHE) * 1024 * 1024;
+
 		/* we get to pick our own modulos */
 		gfx->line_modulo = gfx->origwidth;
 		gfx->char_modulo = gfx->line_modulo * gfx->origheight;
 
-		/* allocate memory for the data */
-		gfx->gfxdata = alloc_array_or_die(UINT8, gfx->total_elements * gfx->char_modulo);
+		/* if the decoded data would exceed the cache size, decode into a bounded cache instead */
+		if (cachebytes != 0 && (UINT64)gfx->total_elements * gfx->char_modulo > cachebytes)
+			gfx->cache = gfx_cache_alloc(gfx, cachebytes / gfx->char_modulo);
+
+		/* otherwise, allocate memory for all the data */
+		else
+			gfx->gfxdata = alloc_array_or_die(UINT8, gfx->total_elements * gfx->char_modulo);
 	}
 
 	return gfx;
@@ -209,7 +277,9 @@ void gfx_element_free(gfx_element *gfx)
 		free(gfx->pen_usage);
 	if (gfx->dirty != NULL)
 		free(gfx->dirty);
-	if (!(gfx->flags & GFX_ELEMENT_DONT_FREE))
+	if (gfx->cache != NULL)
+		gfx_cache_free(gfx->cache);
+	if (!(gfx->flags & GFX_ELEMENT_DONT_FREE) && gfx->gfxdata != NULL)
 		free(gfx->gfxdata);
 	free(gfx);
 }
@@ -247,6 +317,7 @@ void gfx_element_build_temporary(gfx_element *gfx, running_machine *machine, UIN
 	gfx->srcdata = base;
 	gfx->dirty = &not_dirty;
 	gfx->dirtyseq = 0;
+	gfx->cache = NULL;
 
 	gfx->machine = machine;
 }
@@ -257,9 +328,8 @@ void gfx_element_build_temporary(gfx_element *gfx, running_machine *machine, UIN
     a given graphics tile
 -------------------------------------------------*/
 
-static void calc_penusage(const gfx_element *gfx, UINT32 code)
+static void calc_penusage(const gfx_element *gfx, UINT32 code, const UINT8 *dp)
 {
-	const UINT8 *dp = gfx->gfxdata + code * gfx->char_modulo;
 	UINT32 usage = 0;
 	int x, y;
 
@@ -306,13 +376,14 @@ void decodechar(const gfx_element *gfx, UINT32 code, const UINT8 *src)
 	const UINT32 *poffset = gl->planeoffset;
 	const UINT32 *xoffset = gl->extxoffs ? gl->extxoffs : gl->xoffset;
 	const UINT32 *yoffset = gl->extyoffs ? gl->extyoffs : gl->yoffset;
-	UINT8 *dp = gfx->gfxdata + code * gfx->char_modulo;
+	UINT8 *base = element_base(gfx, code);
+	UINT8 *dp;
 	int plane, x, y;
 
 	if (!israw)
 	{
 		/* zap the data to 0 */
-		memset(dp, 0, gfx->char_modulo);
+		memset(base, 0, gfx->char_modulo);
 
 		/* packed case */
 		if (gfx->flags & GFX_ELEMENT_PACKED)
@@ -325,7 +396,7 @@ void decodechar(const gfx_element *gfx, UINT32 code, const UINT8 *src)
 				{
 					int yoffs = planeoffs + yoffset[y];
 
-					dp = gfx->gfxdata + code * gfx->char_modulo + y * gfx->line_modulo;
+					dp = base + y * gfx->line_modulo;
 					for (x = 0; x < gfx->origwidth; x += 2)
 					{
 						if (readbit(src, yoffs + xoffset[x+0]))
@@ -347,7 +418,7 @@ void decodechar(const gfx_element *gfx, UINT32 code, const UINT8 *src)
 				{
 					int yoffs = planeoffs + yoffset[y];
 
-					dp = gfx->gfxdata + code * gfx->char_modulo + y * gfx->line_modulo;
+					dp = base + y * gfx->line_modulo;
 					for (x = 0; x < gfx->origwidth; x++)
 						if (readbit(src, yoffs + xoffset[x]))
 							dp[x] |= planebit;
@@ -356,7 +427,7 @@ void decodechar(const gfx_element *gfx, UINT32 code, const UINT8 *src)
 	}
 
 	/* compute pen usage */
-	calc_penusage(gfx, code);
+	calc_penusage(gfx, code, base);
 
 	/* no longer dirty */
 	gfx->dirty[code] = 0;
@@ -386,7 +457,14 @@ void decodegfx(gfx_element *gfx, UINT32 first, UINT32 count)
 
 		/* compute pen usage for everything */
 		for (c = first; c <= last; c++)
-			calc_penusage(gfx, c);
+			calc_penusage(gfx, c, gfx->gfxdata + c * gfx->char_modulo);
+	}
+
+	/* if we're caching, leave everything to be decoded on demand */
+	else if (gfx->cache != NULL)
+	{
+		for (c = first; c <= last; c++)
+			gfx->dirty[c] = 1;
 	}
 
 	/* otherwise, we get to manually decode */
@@ -397,6 +475,180 @@ void decodegfx(gfx_element *gfx, UINT32 first, UINT32 count)
 
 
 
+/***************************************************************************
+    DECODE CACHE
+***************************************************************************/
+
+/*-------------------------------------------------
+    gfx_element_get_cached_data - return a
+    pointer to the base of the given code within
+    a cached gfx_element, decoding it if needed
+-------------------------------------------------*/
+
+const UINT8 *gfx_element_get_cached_data(const gfx_element *gfx, UINT32 code)
+{
+	const UINT8 *base = gfx_cache_get_slot(gfx, code);
+
+	if (gfx->dirty[code])
+		decodechar(gfx, code, gfx->srcdata);
+	return base + gfx->starty * gfx->line_modulo + gfx->startx;
+}
+
+
+/*-------------------------------------------------
+    gfx_element_disable_cache - drop the decode
+    cache of a gfx_element and give it one block
+    holding every code, for drivers that read
+    gfxdata directly or walk several codes as a
+    single run; call this from VIDEO_START
+-------------------------------------------------*/
+
+void gfx_element_disable_cache(gfx_element *gfx)
+{
+	gfx->flags |= GFX_ELEMENT_NO_CACHE;
+	if (gfx->cache == NULL)
+		return;
+
+	/* nothing decoded so far survives; everything decodes again on demand */
+	gfx_cache_free(gfx->cache);
+	gfx->cache = NULL;
+	gfx->gfxdata = alloc_array_or_die(UINT8, gfx->total_elements * gfx->char_modulo);
+	memset(gfx->dirty, 1, gfx->total_elements * sizeof(*gfx->dirty));
+}
+
+
+/*-------------------------------------------------
+    gfx_element_cache_end_frame - advance the
+    frame number of every cached gfx_element
+-------------------------------------------------*/
+
+void gfx_element_cache_end_frame(running_machine *machine)
+{
+	int gfxnum;
+
+	for (gfxnum = 0; gfxnum < MAX_GFX_ELEMENTS; gfxnum++)
+		if (machine->gfx[gfxnum] != NULL && machine->gfx[gfxnum]->cache != NULL)
+			machine->gfx[gfxnum]->cache->frame++;
+}
+
+
+/*-------------------------------------------------
+    gfx_cache_alloc - allocate a decode cache
+    holding about budget elements
+-------------------------------------------------*/
+
+static gfx_cache *gfx_cache_alloc(const gfx_element *gfx, UINT32 budget)
+{
+	UINT32 total = gfx->total_elements;
+	gfx_cache *cache = alloc_clear_or_die(gfx_cache);
+
+	/* the bookkeeping arrays are sized for the worst case; pixel memory is allocated as it is used */
+	cache->code_slot = alloc_array_or_die(UINT32, total);
+	memset(cache->code_slot, 0xff, total * sizeof(cache->code_slot[0]));
+	cache->slot_code = alloc_array_or_die(UINT32, total);
+	cache->slot_prev = alloc_array_or_die(UINT32, total);
+	cache->slot_next = alloc_array_or_die(UINT32, total);
+	cache->slot_frame = alloc_array_or_die(UINT32, total);
+	cache->chunk = alloc_array_clear_or_die(UINT8 *, (total + GFX_CACHE_CHUNK_SLOTS - 1) / GFX_CACHE_CHUNK_SLOTS);
+
+	cache->budget = MAX(budget, 1);
+	cache->head = cache->tail = GFX_CACHE_NONE;
+	return cache;
+}
+
+
+/*-------------------------------------------------
+    gfx_cache_free - free a decode cache
+-------------------------------------------------*/
+
+static void gfx_cache_free(gfx_cache *cache)
+{
+	UINT32 chunknum;
+
+	for (chunknum = 0; chunknum * GFX_CACHE_CHUNK_SLOTS < cache->slots; chunknum++)
+		free(cache->chunk[chunknum]);
+	free(cache->chunk);
+	free(cache->slot_frame);
+	free(cache->slot_next);
+	free(cache->slot_prev);
+	free(cache->slot_code);
+	free(cache->code_slot);
+	free(cache);
+}
+
+
+/*-------------------------------------------------
+    gfx_cache_get_slot - return the pixel memory
+    for a code, assigning it a slot if it doesn't
+    have one; a newly assigned code is marked
+    dirty so that it gets decoded
+-------------------------------------------------*/
+
+static UINT8 *gfx_cache_get_slot(const gfx_element *gfx, UINT32 code)
+{
+	gfx_cache *cache = gfx->cache;
+	UINT32 slot = cache->code_slot[code];
+
+	/* if we already have a slot, unlink it so it can move to the front */
+	if (slot != GFX_CACHE_NONE)
+	{
+		cache->slot_frame[slot] = cache->frame;
+		if (slot == cache->head)
+			return gfx_cache_slot_base(gfx, slot);
+		cache->slot_next[cache->slot_prev[slot]] = cache->slot_next[slot];
+		if (slot == cache->tail)
+			cache->tail = cache->slot_prev[slot];
+		else
+			cache->slot_prev[cache->slot_next[slot]] = cache->slot_prev[slot];
+	}
+
+	/* take a fresh slot while under budget; data handed out this frame is never recycled, so grow instead */
+	else if (cache->slots < cache->budget || cache->slot_frame[cache->tail] == cache->frame)
+	{
+		slot = cache->slots++;
+		if (slot % GFX_CACHE_CHUNK_SLOTS == 0)
+			cache->chunk[slot / GFX_CACHE_CHUNK_SLOTS] = alloc_array_or_die(UINT8, GFX_CACHE_CHUNK_SLOTS * gfx->char_modulo);
+		cache->slot_code[slot] = code;
+		cache->code_slot[code] = slot;
+		gfx->dirty[code] = 1;
+	}
+
+	/* otherwise, recycle the least recently used slot */
+	else
+	{
+		UINT32 oldcode;
+
+		slot = cache->tail;
+		cache->tail = cache->slot_prev[slot];
+		if (cache->tail != GFX_CACHE_NONE)
+			cache->slot_next[cache->tail] = GFX_CACHE_NONE;
+		else
+			cache->head = GFX_CACHE_NONE;
+
+		/* the evicted code needs decoding again, but its contents haven't changed so dirtyseq is left alone */
+		oldcode = cache->slot_code[slot];
+		cache->code_slot[oldcode] = GFX_CACHE_NONE;
+		gfx->dirty[oldcode] = 1;
+
+		cache->slot_code[slot] = code;
+		cache->code_slot[code] = slot;
+		gfx->dirty[code] = 1;
+	}
+
+	/* link at the front of the list */
+	cache->slot_prev[slot] = GFX_CACHE_NONE;
+	cache->slot_next[slot] = cache->head;
+	if (cache->head != GFX_CACHE_NONE)
+		cache->slot_prev[cache->head] = slot;
+	else
+		cache->tail = slot;
+	cache->head = slot;
+	cache->slot_frame[slot] = cache->frame;
+	return gfx_cache_slot_base(gfx, slot);
+}
+
+
+
 /***************************************************************************
     DRAWGFX IMPLEMENTATIONS
 ***************************************************************************/
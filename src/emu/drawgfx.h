@@ -31,6 +31,7 @@
 
 #define GFX_ELEMENT_PACKED		1	/* two 4bpp pixels are packed in one byte of gfxdata */
 #define GFX_ELEMENT_DONT_FREE	2	/* gfxdata was not malloc()ed, so don't free it on exit */
+#define GFX_ELEMENT_NO_CACHE	4	/* all codes live in one gfxdata block, even with -gfxcache */
 
 #define GFX_RAW 				0x12345678
 /* When planeoffset[0] is set to GFX_RAW, the gfx data is left as-is, with no conversion.
@@ -99,6 +100,10 @@ const gfx_layout name = { width, height, RGN_FRAC(1,1), planes, { GFX_RAW }, { 0
     TYPE DEFINITIONS
 ***************************************************************************/
 
+/* opaque bounded cache of decoded elements */
+typedef struct _gfx_cache gfx_cache;
+
+
 typedef struct _gfx_layout gfx_layout;
 struct _gfx_layout
 {
@@ -141,6 +146,7 @@ struct _gfx_element
 	const UINT8 *	srcdata;			/* pointer to the source data for decoding */
 	UINT8 *			dirty;				/* dirty array for detecting tiles that need decoding */
 	UINT32			dirtyseq;			/* sequence number; incremented each time a tile is dirtied */
+	gfx_cache *		cache;				/* bounded decode cache, or NULL if gfxdata holds every element */
 
 	running_machine *machine;			/* pointer to the owning machine */
 	gfx_layout		layout;				/* copy of the original layout */
@@ -177,6 +183,15 @@ void gfx_element_decode(const gfx_element *gfx, UINT32 code);
 /* free a gfx_element */
 void gfx_element_free(gfx_element *gfx);
 
+/* return a pointer to the decoded data for a code in a cached gfx_element */
+const UINT8 *gfx_element_get_cached_data(const gfx_element *gfx, UINT32 code);
+
+/* keep all codes in one contiguous gfxdata block, for drivers that address it directly */
+void gfx_element_disable_cache(gfx_element *gfx);
+
+/* note the end of a video frame; cached data fetched before this may now be evicted */
+void gfx_element_cache_end_frame(running_machine *machine);
+
 /* create a temporary one-off gfx_element */
 void gfx_element_build_temporary(gfx_element *gfx, running_machine *machine, UINT8 *base, UINT32 width, UINT32 height, UINT32 rowbytes, UINT32 color_base, UINT32 color_granularity, UINT32 flags);
 
@@ -344,6 +359,8 @@ INLINE void gfx_element_set_source(gfx_element *gfx, const UINT8 *source)
 INLINE const UINT8 *gfx_element_get_data(const gfx_element *gfx, UINT32 code)
 {
 	assert(code < gfx->total_elements);
+	if (gfx->cache != NULL)
+		return gfx_element_get_cached_data(gfx, code);
 	if (gfx->dirty[code])
 		gfx_element_decode(gfx, code);
 	return gfx->gfxdata + code * gfx->char_modulo + gfx->starty * gfx->line_modulo + gfx->startx;
@@ -200,6 +200,8 @@ EMUVIDEOOBJS = \
 	$(EMUVIDEO)/resnet.o \
 	$(EMUVIDEO)/rgbutil.o \
 	$(EMUVIDEO)/s2636.o \
+	$(EMUVIDEO)/spritelist.o \
+	$(EMUVIDEO)/tilecomp.o \
 	$(EMUVIDEO)/tlc34076.o \
 	$(EMUVIDEO)/tms34061.o \
  	$(EMUVIDEO)/tms9927.o \
@@ -101,6 +101,8 @@ const options_entry mame_core_options[] =
 	{ "sleep",                       "1",         OPTION_BOOLEAN,    "enable sleeping, which gives time back to other applications when idle" },
 	{ "speed(0.01-100)",             "1.0",       0,                 "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ "refreshspeed;rs",             "0",         OPTION_BOOLEAN,    "automatically adjusts the speed of gameplay to keep the refresh rate lower than the screen" },
+	{ "mttilemap",                   "0",         OPTION_BOOLEAN,    "render tilemaps in horizontal bands across multiple threads" },
+	{ "gfxcache",                    "0",         0,                 "maximum megabytes of decoded graphics to keep per graphics set; 0 keeps everything" },
 
 	/* rotation options */
 	{ NULL,                          NULL,        OPTION_HEADER,     "CORE ROTATION OPTIONS" },
@@ -134,6 +136,7 @@ const options_entry mame_core_options[] =
 	{ "antialias;aa",                "1",         OPTION_BOOLEAN,    "use antialiasing when drawing vectors" },
 	{ "beam",                        "1.0",       0,                 "set vector beam width" },
 	{ "flicker",                     "0",         0,                 "set vector flicker effect" },
+	{ "persistence(0.0-0.99)",       "0",         0,                 "fraction of vector brightness that carries over to the next frame" },
 
 	/* sound options */
 	{ NULL,                          NULL,        OPTION_HEADER,     "CORE SOUND OPTIONS" },
@@ -178,6 +181,7 @@ const options_entry mame_core_options[] =
 	{ "update_in_pause",             "0",         OPTION_BOOLEAN,    "keep calling video updates while in pause" },
 	{ "debug;d",                     "0",         OPTION_BOOLEAN,    "enable/disable debugger" },
 	{ "debugscript",                 NULL,        0,                 "script for debugger" },
+	{ "cpuprofile",                  "0",         OPTION_BOOLEAN,    "sample CPU program counters and write a profile to cpuprof.txt on exit" },
 
 	/* misc options */
 	{ NULL,                          NULL,        OPTION_HEADER,     "CORE MISC OPTIONS" },
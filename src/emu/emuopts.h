@@ -103,6 +103,8 @@
 #define OPTION_SLEEP				"sleep"
 #define OPTION_SPEED				"speed"
 #define OPTION_REFRESHSPEED			"refreshspeed"
+#define OPTION_MTTILEMAP			"mttilemap"
+#define OPTION_GFXCACHE				"gfxcache"
 
 /* core rotation options */
 #define OPTION_ROTATE				"rotate"
@@ -132,6 +134,7 @@
 #define OPTION_ANTIALIAS			"antialias"
 #define OPTION_BEAM					"beam"
 #define OPTION_FLICKER				"flicker"
+#define OPTION_PERSISTENCE			"persistence"
 
 /* core sound options */
 #define OPTION_SOUND				"sound"
@@ -170,6 +173,7 @@
 #define OPTION_DEBUG				"debug"
 #define OPTION_DEBUGSCRIPT			"debugscript"
 #define OPTION_UPDATEINPAUSE		"update_in_pause"
+#define OPTION_CPUPROFILE			"cpuprofile"
 
 /* core misc options */
 #define OPTION_BIOS					"bios"
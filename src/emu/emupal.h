@@ -242,8 +242,7 @@ INLINE void palette_set_pen_contrast(running_machine *machine, pen_t pen, double
 
 INLINE void palette_set_colors(running_machine *machine, pen_t color_base, const rgb_t *colors, int color_count)
 {
-	while (color_count--)
-		palette_entry_set_color(machine->palette, color_base++, *colors++);
+	palette_entry_set_colors(machine->palette, color_base, colors, color_count);
 }
 
 
@@ -335,6 +335,7 @@ static void table_compute_subhandler(handler_data **table, UINT8 entry, read_or_
 static void table_populate_range(address_table *tabledata, offs_t bytestart, offs_t byteend, UINT8 handler);
 static void table_populate_range_mirrored(address_space *space, address_table *tabledata, offs_t bytestart, offs_t byteend, offs_t bytemirror, UINT8 handler);
 static UINT8 table_derive_range(const address_table *table, offs_t byteaddress, offs_t *bytestart, offs_t *byteend);
+static UINT8 table_range_entry(const address_table *table, offs_t bytestart, offs_t byteend);
 
 /* subtable management */
 static UINT8 subtable_alloc(address_table *tabledata);
@@ -996,6 +997,48 @@ void *memory_get_write_ptr(const address_space *space, offs_t byteaddress)
 	return &(*handler->bankbaseptr)[byteoffset];
 }
 
+/*-------------------------------------------------
+    memory_get_range_ptr - return a pointer to
+    the first byte of a range in the given address
+    space if every byte of it is read and written
+    through the same bank contiguously, or NULL
+    otherwise
+-------------------------------------------------*/
+
+void *memory_get_range_ptr(const address_space *space, offs_t bytestart, offs_t byteend)
+{
+	const handler_data *handler;
+	UINT8 *startptr;
+	UINT8 entry;
+
+	/* the range must not wrap */
+	bytestart &= space->bytemask;
+	byteend &= space->bytemask;
+	if (byteend < bytestart)
+		return NULL;
+
+	/* every byte must resolve to the same write bank */
+	entry = table_range_entry(&space->write, bytestart, byteend);
+	if (entry == STATIC_INVALID || entry >= STATIC_RAM)
+		return NULL;
+	handler = space->write.handlers[entry];
+
+	/* the bank must not mirror inside the range */
+	if (((bytestart - handler->bytestart) & handler->bytemask) + (byteend - bytestart) > handler->bytemask)
+		return NULL;
+	startptr = &(*handler->bankbaseptr)[(bytestart - handler->bytestart) & handler->bytemask];
+
+	/* and reads must come from the same memory */
+	entry = table_range_entry(&space->read, bytestart, byteend);
+	if (entry == STATIC_INVALID || entry >= STATIC_RAM)
+		return NULL;
+	handler = space->read.handlers[entry];
+	if (&(*handler->bankbaseptr)[(bytestart - handler->bytestart) & handler->bytemask] != startptr)
+		return NULL;
+	return startptr;
+}
+
+
 
 
 /***************************************************************************
@@ -2804,6 +2847,50 @@ static UINT8 table_derive_range(const address_table *table, offs_t byteaddress,
 }
 
 
+/*-------------------------------------------------
+    table_range_entry - return the entry that
+    every byte of a range maps to, or
+    STATIC_INVALID if the range is split between
+    several entries
+-------------------------------------------------*/
+
+static UINT8 table_range_entry(const address_table *table, offs_t bytestart, offs_t byteend)
+{
+	offs_t byteaddress = bytestart;
+	UINT8 entry, l1entry;
+
+	/* look up the entry of the first byte */
+	entry = l1entry = table->table[LEVEL1_INDEX(bytestart)];
+	if (l1entry >= SUBTABLE_BASE)
+		entry = table->table[LEVEL2_INDEX(l1entry, bytestart)];
+
+	/* then walk the range one L1 entry at a time */
+	while (1)
+	{
+		offs_t l1end = byteaddress | ((1 << LEVEL2_BITS) - 1);
+		if (l1end > byteend)
+			l1end = byteend;
+
+		/* subtables are checked byte by byte, plain L1 entries as a whole */
+		l1entry = table->table[LEVEL1_INDEX(byteaddress)];
+		if (l1entry >= SUBTABLE_BASE)
+		{
+			UINT32 index, maxindex = LEVEL2_INDEX(l1entry, l1end);
+			for (index = LEVEL2_INDEX(l1entry, byteaddress); index <= maxindex; index++)
+				if (table->table[index] != entry)
+					return STATIC_INVALID;
+		}
+		else if (l1entry != entry)
+			return STATIC_INVALID;
+
+		if (l1end == byteend)
+			break;
+		byteaddress = l1end + 1;
+	}
+	return entry;
+}
+
+
 
 /***************************************************************************
     SUBTABLE MANAGEMENT
@@ -836,6 +836,9 @@ void *memory_get_read_ptr(const address_space *space, offs_t byteaddress) ATTR_N
 /* return a pointer the memory byte provided in the given address space, or NULL if it is not mapped to a writeable bank */
 void *memory_get_write_ptr(const address_space *space, offs_t byteaddress) ATTR_NONNULL(1);
 
+/* return a pointer to the first byte of a range if all of it is read and written through the same bank, or NULL otherwise */
+void *memory_get_range_ptr(const address_space *space, offs_t bytestart, offs_t byteend) ATTR_NONNULL(1);
+
 
 
 /* ----- memory banking ----- */
@@ -52,7 +52,8 @@
     CONSTANTS
 ***************************************************************************/
 
-#define MAX_TEXTURE_SCALES		8
+#define MAX_TEXTURE_SCALES		16
+#define MAX_SCALED_BYTES		(64 * 1024 * 1024)
 #define TEXTURE_GROUP_SIZE		256
 
 #define NUM_PRIMLISTS			3
@@ -74,6 +75,7 @@ enum
 {
 	CONTAINER_ITEM_LINE = 0,
 	CONTAINER_ITEM_QUAD,
+	CONTAINER_ITEM_LINES,
 	CONTAINER_ITEM_MAX
 };
 
@@ -98,6 +100,8 @@ enum
 typedef struct _object_transform object_transform;
 typedef struct _scaled_texture scaled_texture;
 typedef struct _container_item container_item;
+typedef struct _retained_list retained_list;
+typedef struct _clear_key clear_key;
 
 
 /* a render_ref is an abstract reference to an internal object of some sort */
@@ -123,6 +127,11 @@ struct _scaled_texture
 {
 	bitmap_t *			bitmap;				/* final bitmap */
 	UINT32				seqid;				/* sequence number */
+	render_texture *	owner;				/* texture this is a scaled version of */
+	osd_work_item *		work;				/* pending asynchronous scale, or NULL if ready */
+	scaled_texture *	pendnext;			/* next entry with a pending scale */
+	scaled_texture *	lruprev;			/* more recently used entry */
+	scaled_texture *	lrunext;			/* less recently used entry */
 };
 
 
@@ -144,6 +153,28 @@ struct _render_texture
 };
 
 
+/* a retained_list caches the primitives built for part of a target between frames */
+struct _retained_list
+{
+	render_primitive_list list;				/* cached primitives and the references they hold */
+	int					valid;				/* TRUE if the list was built from the current signature */
+	UINT32 *			sig;				/* signature of the inputs the list depends on */
+	int					sigcount;			/* number of words in the signature */
+	int					sigmax;				/* number of words allocated */
+	int					sigindex;			/* next word to check */
+	int					sigchanged;			/* TRUE if the signature differs from the last frame */
+};
+
+
+/* a clear_key holds the parts of a primitive that the clear extents depend on */
+struct _clear_key
+{
+	int					type;				/* type of primitive */
+	UINT32				flags;				/* flags */
+	render_bounds		bounds;				/* bounds */
+};
+
+
 /* a render_target describes a surface that is being rendered to */
 struct _render_target
 {
@@ -166,6 +197,17 @@ struct _render_target
 	int					base_layerconfig;	/* the layer configuration at the time of first frame */
 	int					maxtexwidth;		/* maximum width of a texture */
 	int					maxtexheight;		/* maximum height of a texture */
+	retained_list		retained_layer[ITEM_LAYER_MAX];/* cached primitives for layers without screens */
+	retained_list		retained_ui;		/* cached primitives for the UI container */
+	clear_key *			clearkey;			/* leading primitives the cached clear extents came from */
+	int					clearkeycount;		/* number of leading primitives */
+	int					clearkeymax;		/* number of keys allocated */
+	int					clearremoved;		/* number of leading primitives removed from the extents */
+	int					clearend;			/* TRUE if the scan reached the end of the list */
+	INT32				clearwidth;			/* width the cached extents were computed for */
+	INT32				clearheight;		/* height the cached extents were computed for */
+	INT32				clearextentcount;	/* number of cached extents */
+	INT32				clearextents[MAX_CLEAR_EXTENTS];/* cached extents */
 };
 
 
@@ -180,6 +222,9 @@ struct _container_item
 	UINT32				internal;			/* internal flags */
 	float				width;				/* width of the line (lines only) */
 	render_texture *	texture;			/* pointer to the source texture (quads only) */
+	render_bounds		texbounds;			/* part of the texture to show (quads only) */
+	render_line_segment *segments;			/* segments of a line batch (line batches only) */
+	UINT32				numsegments;		/* number of segments (line batches only) */
 };
 
 
@@ -231,6 +276,14 @@ static bitmap_t *screen_overlay;
 static INT32 clear_extents[MAX_CLEAR_EXTENTS];
 static INT32 clear_extent_count;
 
+/* scaled texture cache */
+static osd_work_queue *scale_queue;
+static scaled_texture *scaled_lru_head;
+static scaled_texture *scaled_lru_tail;
+static scaled_texture *scaled_pending_list;
+static UINT64 scaled_bytes;
+static UINT32 scaled_generation;
+
 /* precomputed UV coordinates for various orientations */
 static const render_quad_texuv oriented_texcoords[8] =
 {
@@ -265,12 +318,24 @@ static int load_layout_files(render_target *target, const char *layoutfile, int
 static void add_container_primitives(render_target *target, render_primitive_list *list, const object_transform *xform, render_container *container, int blendmode);
 static void add_element_primitives(render_target *target, render_primitive_list *list, const object_transform *xform, const layout_element *element, int state, int blendmode);
 static void add_clear_and_optimize_primitive_list(render_target *target, render_primitive_list *list);
+static void add_layer_primitives(render_target *target, render_primitive_list *list, const object_transform *root_xform, int layer, int blendmode);
+static int get_view_item_state(render_target *target, const view_item *item);
+
+/* retained primitives */
+static void retained_begin(render_target *target, retained_list *retained);
+static void retained_add_container(retained_list *retained, const render_container *container);
+static int retained_end(retained_list *retained);
+static void retained_append(render_primitive_list *list, const retained_list *retained);
+static void retained_free(retained_list *retained);
 
 /* render references */
 static void invalidate_all_render_ref(void *refptr);
 
 /* render textures */
 static int texture_get_scaled(render_texture *texture, UINT32 dwidth, UINT32 dheight, render_texinfo *texinfo, render_ref **reflist);
+static void texture_free_scaled(scaled_texture *scaled);
+static void texture_wait_scaled(render_texture *texture);
+static void texture_poll_scaled(int wait);
 static const rgb_t *texture_get_adjusted_palette(render_texture *texture, render_container *container);
 
 /* render containers */
@@ -331,6 +396,45 @@ INLINE void normalize_bounds(render_bounds *bounds)
 }
 
 
+/*-------------------------------------------------
+    map_texcoords - map texture coordinates into
+    a sub-rectangle of the texture
+-------------------------------------------------*/
+
+INLINE void map_texcoords(render_quad_texuv *texcoords, const render_bounds *texbounds)
+{
+	float du = texbounds->x1 - texbounds->x0;
+	float dv = texbounds->y1 - texbounds->y0;
+
+	texcoords->tl.u = texbounds->x0 + texcoords->tl.u * du;
+	texcoords->tl.v = texbounds->y0 + texcoords->tl.v * dv;
+	texcoords->tr.u = texbounds->x0 + texcoords->tr.u * du;
+	texcoords->tr.v = texbounds->y0 + texcoords->tr.v * dv;
+	texcoords->bl.u = texbounds->x0 + texcoords->bl.u * du;
+	texcoords->bl.v = texbounds->y0 + texcoords->bl.v * dv;
+	texcoords->br.u = texbounds->x0 + texcoords->br.u * du;
+	texcoords->br.v = texbounds->y0 + texcoords->br.v * dv;
+}
+
+
+/*-------------------------------------------------
+    apply_brightness_contrast_gamma_lookup -
+    apply a container's brightness, contrast and
+    gamma to a single component via its lookup
+    table
+-------------------------------------------------*/
+
+INLINE float apply_brightness_contrast_gamma_lookup(const render_container *container, float val)
+{
+	int index = (int)(val * 255.0f + 0.5f);
+	if (index < 0)
+		index = 0;
+	if (index > 255)
+		index = 255;
+	return (float)container->bcglookup256[index] * (1.0f / 255.0f);
+}
+
+
 /*-------------------------------------------------
     alloc_container_item - allocate a new
     container item object
@@ -358,6 +462,8 @@ INLINE container_item *alloc_container_item(void)
 
 INLINE void free_container_item(container_item *item)
 {
+	if (item->segments != NULL)
+		free(item->segments);
 	item->next = container_item_free_list;
 	container_item_free_list = item;
 }
@@ -404,24 +510,22 @@ INLINE void append_render_primitive(render_primitive_list *list, render_primitiv
 
 INLINE void free_render_primitive(render_primitive *element)
 {
+	if (element->segments != NULL)
+		free(element->segments);
 	element->next = render_primitive_free_list;
 	render_primitive_free_list = element;
 }
 
 
 /*-------------------------------------------------
-    add_render_ref - add a new reference
+    link_render_ref - add a new reference without
+    checking for duplicates
 -------------------------------------------------*/
 
-INLINE void add_render_ref(render_ref **list, void *refptr)
+INLINE void link_render_ref(render_ref **list, void *refptr)
 {
 	render_ref *ref;
 
-	/* skip if we already have one */
-	for (ref = *list; ref != NULL; ref = ref->next)
-		if (ref->refptr == refptr)
-			return;
-
 	/* allocate from the free list if we can; otherwise, malloc a new item */
 	ref = render_ref_free_list;
 	if (ref != NULL)
@@ -436,6 +540,23 @@ INLINE void add_render_ref(render_ref **list, void *refptr)
 }
 
 
+/*-------------------------------------------------
+    add_render_ref - add a new reference
+-------------------------------------------------*/
+
+INLINE void add_render_ref(render_ref **list, void *refptr)
+{
+	render_ref *ref;
+
+	/* skip if we already have one */
+	for (ref = *list; ref != NULL; ref = ref->next)
+		if (ref->refptr == refptr)
+			return;
+
+	link_render_ref(list, refptr);
+}
+
+
 /*-------------------------------------------------
     has_render_ref - find a refptr in a reference
     list
@@ -529,6 +650,58 @@ INLINE render_container *get_screen_container_by_index(int index)
 }
 
 
+/*-------------------------------------------------
+    retained_add - add a word to the signature
+    of a retained list, noting any change from
+    the last frame
+-------------------------------------------------*/
+
+INLINE void retained_add(retained_list *retained, UINT32 value)
+{
+	/* grow the signature if we need to */
+	if (retained->sigindex >= retained->sigmax)
+	{
+		retained->sigmax = (retained->sigmax == 0) ? 64 : retained->sigmax * 2;
+		retained->sig = (UINT32 *)realloc(retained->sig, retained->sigmax * sizeof(*retained->sig));
+		assert_always(retained->sig != NULL, "Out of memory for retained primitive signature");
+	}
+
+	if (retained->sigindex >= retained->sigcount || retained->sig[retained->sigindex] != value)
+	{
+		retained->sig[retained->sigindex] = value;
+		retained->sigchanged = TRUE;
+	}
+	retained->sigindex++;
+}
+
+
+/*-------------------------------------------------
+    retained_add_float - add a float to the
+    signature of a retained list
+-------------------------------------------------*/
+
+INLINE void retained_add_float(retained_list *retained, float value)
+{
+	union { float f; UINT32 i; } u;
+	u.f = value;
+	retained_add(retained, u.i);
+}
+
+
+/*-------------------------------------------------
+    retained_add_ptr - add a pointer to the
+    signature of a retained list
+-------------------------------------------------*/
+
+INLINE void retained_add_ptr(retained_list *retained, const void *ptr)
+{
+	retained_add(retained, (UINT32)(FPTR)ptr);
+#ifdef PTR64
+	retained_add(retained, (UINT32)((UINT64)(FPTR)ptr >> 32));
+#endif
+}
+
+
 
 /***************************************************************************
     CORE IMPLEMENTATION
@@ -557,6 +730,13 @@ void render_init(running_machine *machine)
 	/* zap more variables */
 	ui_target = NULL;
 
+	/* set up the scaled texture cache; rescales run on a work queue */
+	scaled_lru_head = scaled_lru_tail = NULL;
+	scaled_pending_list = NULL;
+	scaled_bytes = 0;
+	scaled_generation = 0;
+	scale_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	/* create a UI container */
 	ui_container = render_container_alloc(machine);
 
@@ -599,6 +779,9 @@ static void render_exit(running_machine *machine)
 	render_texture **texture_ptr;
 	render_container *container;
 
+	/* wait for any background scaling to finish */
+	texture_poll_scaled(TRUE);
+
 	/* free the UI container */
 	if (ui_container != NULL)
 		render_container_free(ui_container);
@@ -656,6 +839,11 @@ static void render_exit(running_machine *machine)
 	if (screen_overlay != NULL)
 		bitmap_free(screen_overlay);
 	screen_overlay = NULL;
+
+	/* free the scaling work queue */
+	if (scale_queue != NULL)
+		osd_work_queue_free(scale_queue);
+	scale_queue = NULL;
 }
 
 
@@ -1152,6 +1340,16 @@ render_target *render_target_alloc(running_machine *machine, const char *layoutf
 	/* allocate a lock for the primitive list */
 	for (listnum = 0; listnum < ARRAY_LENGTH(target->primlist); listnum++)
 		target->primlist[listnum].lock = osd_lock_alloc();
+	for (listnum = 0; listnum < ARRAY_LENGTH(target->retained_layer); listnum++)
+	{
+		target->retained_layer[listnum].list.lock = osd_lock_alloc();
+		target->retained_layer[listnum].list.nextptr = &target->retained_layer[listnum].list.head;
+	}
+	target->retained_ui.list.lock = osd_lock_alloc();
+	target->retained_ui.list.nextptr = &target->retained_ui.list.head;
+
+	/* no clear extents have been computed yet */
+	target->clearwidth = target->clearheight = -1;
 
 	/* load the layout files */
 	if (load_layout_files(target, layoutfile, flags & RENDER_CREATE_SINGLE_FILE))
@@ -1190,6 +1388,11 @@ void render_target_free(render_target *target)
 		release_render_list(&target->primlist[listnum]);
 		osd_lock_free(target->primlist[listnum].lock);
 	}
+	for (listnum = 0; listnum < ARRAY_LENGTH(target->retained_layer); listnum++)
+		retained_free(&target->retained_layer[listnum]);
+	retained_free(&target->retained_ui);
+	if (target->clearkey != NULL)
+		free(target->clearkey);
 
 	/* free the layout files */
 	while (target->filelist != NULL)
@@ -1621,7 +1824,6 @@ void render_target_get_minimum_size(render_target *target, INT32 *minwidth, INT3
 const render_primitive_list *render_target_get_primitives(render_target *target)
 {
 	object_transform root_xform, ui_xform;
-	int itemcount[ITEM_LAYER_MAX];
 	INT32 viswidth, visheight;
 	int layernum, listnum;
 
@@ -1629,6 +1831,10 @@ const render_primitive_list *render_target_get_primitives(render_target *target)
 	if (target->base_view == NULL)
 		target->base_view = target->curview;
 
+	/* pick up any textures that finished scaling in the background */
+	if (scaled_pending_list != NULL)
+		texture_poll_scaled(FALSE);
+
 	/* switch to the next primitive list */
 	listnum = target->listindex;
 	target->listindex = (target->listindex + 1) % ARRAY_LENGTH(target->primlist);
@@ -1657,53 +1863,31 @@ const render_primitive_list *render_target_get_primitives(render_target *target)
 
 			if (target->curview->layenabled[layer])
 			{
+				retained_list *retained = &target->retained_layer[layer];
 				view_item *item;
 
-				/* iterate over items in the layer */
-				itemcount[layer] = 0;
+				/* layers made only of elements depend on nothing but the element states */
+				retained_begin(target, retained);
+				retained_add(retained, blendmode);
 				for (item = target->curview->itemlist[layer]; item != NULL; item = item->next)
 				{
-					object_transform item_xform;
-					render_bounds bounds;
-
-					/* first apply orientation to the bounds */
-					bounds = item->bounds;
-					apply_orientation(&bounds, root_xform.orientation);
-					normalize_bounds(&bounds);
-
-					/* apply the transform to the item */
-					item_xform.xoffs = root_xform.xoffs + bounds.x0 * root_xform.xscale;
-					item_xform.yoffs = root_xform.yoffs + bounds.y0 * root_xform.yscale;
-					item_xform.xscale = (bounds.x1 - bounds.x0) * root_xform.xscale;
-					item_xform.yscale = (bounds.y1 - bounds.y0) * root_xform.yscale;
-					item_xform.color.r = item->color.r * root_xform.color.r;
-					item_xform.color.g = item->color.g * root_xform.color.g;
-					item_xform.color.b = item->color.b * root_xform.color.b;
-					item_xform.color.a = item->color.a * root_xform.color.a;
-					item_xform.orientation = orientation_add(item->orientation, root_xform.orientation);
-
-					/* if there is no associated element, it must be a screen element */
-					if (item->element != NULL)
-					{
-						int state = 0;
-						if (item->output_name[0] != 0)
-							state = output_get_value(item->output_name);
-						else if (item->input_tag[0] != 0)
-						{
-							const input_field_config *field = input_field_by_tag_and_mask(target->machine->portconfig, item->input_tag, item->input_mask);
-							if (field != NULL)
-								state = ((input_port_read_safe(target->machine, item->input_tag, 0) ^ field->defvalue) & item->input_mask) ? 1 : 0;
-						}
-						add_element_primitives(target, &target->primlist[listnum], &item_xform, item->element, state, blendmode);
-					}
+					if (item->element == NULL)
+						retained->sigchanged = TRUE;
 					else
+						retained_add(retained, get_view_item_state(target, item));
+				}
+
+				/* rebuild the layer if anything changed; otherwise, reuse the last one */
+				if (!retained_end(retained))
+					add_layer_primitives(target, &target->primlist[listnum], &root_xform, layer, blendmode);
+				else
+				{
+					if (!retained->valid)
 					{
-						render_container *container = get_screen_container_by_index(item->index);
-						add_container_primitives(target, &target->primlist[listnum], &item_xform, container, blendmode);
+						add_layer_primitives(target, &retained->list, &root_xform, layer, blendmode);
+						retained->valid = TRUE;
 					}
-
-					/* keep track of how many items are in the layer */
-					itemcount[layer]++;
+					retained_append(&target->primlist[listnum], retained);
 				}
 			}
 		}
@@ -1742,8 +1926,22 @@ const render_primitive_list *render_target_get_primitives(render_target *target)
 		ui_xform.color.r = ui_xform.color.g = ui_xform.color.b = ui_xform.color.a = 1.0f;
 		ui_xform.orientation = target->orientation;
 
-		/* add UI elements */
-		add_container_primitives(target, &target->primlist[listnum], &ui_xform, ui_container, BLENDMODE_ALPHA);
+		/* add UI elements, reusing last frame's primitives if the UI did not change */
+		retained_begin(target, &target->retained_ui);
+		retained_add_container(&target->retained_ui, ui_container);
+		if (!retained_end(&target->retained_ui))
+			add_container_primitives(target, &target->primlist[listnum], &ui_xform, ui_container, BLENDMODE_ALPHA);
+		else
+		{
+			if (!target->retained_ui.valid)
+			{
+				add_container_primitives(target, &target->retained_ui.list, &ui_xform, ui_container, BLENDMODE_ALPHA);
+				target->retained_ui.valid = TRUE;
+			}
+			else
+				render_container_update_palette(ui_container);
+			retained_append(&target->primlist[listnum], &target->retained_ui);
+		}
 	}
 
 	/* optimize the list before handing it off */
@@ -1753,6 +1951,41 @@ const render_primitive_list *render_target_get_primitives(render_target *target)
 }
 
 
+/*-------------------------------------------------
+    render_primitive_list_get_direct - if a list
+    is nothing but one unscaled, unmodulated
+    32bpp quad covering the whole target, return
+    its texture so the caller can use the pixels
+    as they are
+-------------------------------------------------*/
+
+const render_texinfo *render_primitive_list_get_direct(const render_primitive_list *list, INT32 width, INT32 height)
+{
+	const render_primitive *prim = list->head;
+
+	/* exactly one textured quad */
+	if (prim == NULL || prim->next != NULL || prim->type != RENDER_PRIMITIVE_QUAD || prim->texture.base == NULL)
+		return NULL;
+
+	/* plain RGB32 copied straight through: no palette, tint, blending or rotation */
+	if (PRIMFLAG_GET_TEXFORMAT(prim->flags) != TEXFORMAT_RGB32 || prim->texture.palette != NULL ||
+		PRIMFLAG_GET_BLENDMODE(prim->flags) != BLENDMODE_NONE || PRIMFLAG_GET_TEXORIENT(prim->flags) != ROT0)
+		return NULL;
+	if (prim->color.r != 1.0f || prim->color.g != 1.0f || prim->color.b != 1.0f)
+		return NULL;
+
+	/* covering the target one texel per pixel */
+	if (prim->bounds.x0 != 0.0f || prim->bounds.y0 != 0.0f || prim->bounds.x1 != (float)width || prim->bounds.y1 != (float)height)
+		return NULL;
+	if (prim->texture.width != width || prim->texture.height != height)
+		return NULL;
+	if (prim->texcoords.tl.u != 0.0f || prim->texcoords.tl.v != 0.0f || prim->texcoords.br.u != 1.0f || prim->texcoords.br.v != 1.0f)
+		return NULL;
+
+	return &prim->texture;
+}
+
+
 /*-------------------------------------------------
     render_target_map_point_internal - internal
     logic for mapping points
@@ -1880,7 +2113,7 @@ static int load_layout_files(render_target *target, const char *layoutfile, int
 	/* if there's an explicit file, load that first */
 	if (layoutfile != NULL)
 	{
-		*nextfile = layout_file_load(config, basename, layoutfile);
+		*nextfile = layout_file_load(config, basename, layoutfile, gamedrv->name);
 		if (*nextfile != NULL)
 			nextfile = &(*nextfile)->next;
 	}
@@ -1890,22 +2123,22 @@ static int load_layout_files(render_target *target, const char *layoutfile, int
 		return (nextfile == &target->filelist) ? 1 : 0;
 
 	/* try to load a file based on the driver name */
-	*nextfile = layout_file_load(config, basename, gamedrv->name);
+	*nextfile = layout_file_load(config, basename, gamedrv->name, gamedrv->name);
 	if (*nextfile == NULL)
-		*nextfile = layout_file_load(config, basename, "default");
+		*nextfile = layout_file_load(config, basename, "default", gamedrv->name);
 	if (*nextfile != NULL)
 		nextfile = &(*nextfile)->next;
 
 	/* if a default view has been specified, use that as a fallback */
 	if (gamedrv->default_layout != NULL)
 	{
-		*nextfile = layout_file_load(config, NULL, gamedrv->default_layout);
+		*nextfile = layout_file_load(config, NULL, gamedrv->default_layout, gamedrv->name);
 		if (*nextfile != NULL)
 			nextfile = &(*nextfile)->next;
 	}
 	if (config->default_layout != NULL)
 	{
-		*nextfile = layout_file_load(config, NULL, config->default_layout);
+		*nextfile = layout_file_load(config, NULL, config->default_layout, gamedrv->name);
 		if (*nextfile != NULL)
 			nextfile = &(*nextfile)->next;
 	}
@@ -1914,9 +2147,9 @@ static int load_layout_files(render_target *target, const char *layoutfile, int
 	cloneof = driver_get_clone(gamedrv);
 	if (cloneof != NULL)
 	{
-		*nextfile = layout_file_load(config, cloneof->name, cloneof->name);
+		*nextfile = layout_file_load(config, cloneof->name, cloneof->name, gamedrv->name);
 		if (*nextfile == NULL)
-			*nextfile = layout_file_load(config, cloneof->name, "default");
+			*nextfile = layout_file_load(config, cloneof->name, "default", gamedrv->name);
 		if (*nextfile != NULL)
 			nextfile = &(*nextfile)->next;
 	}
@@ -1925,9 +2158,9 @@ static int load_layout_files(render_target *target, const char *layoutfile, int
 	if (video_screen_count(config) == 1)
 	{
 		if (gamedrv->flags & ORIENTATION_SWAP_XY)
-			*nextfile = layout_file_load(config, NULL, layout_vertical);
+			*nextfile = layout_file_load(config, NULL, layout_vertical, gamedrv->name);
 		else
-			*nextfile = layout_file_load(config, NULL, layout_horizont);
+			*nextfile = layout_file_load(config, NULL, layout_horizont, gamedrv->name);
 		assert_always(*nextfile != NULL, "Couldn't parse default layout??");
 		nextfile = &(*nextfile)->next;
 	}
@@ -1967,6 +2200,70 @@ static void release_render_list(render_primitive_list *list)
 }
 
 
+/*-------------------------------------------------
+    get_view_item_state - return the current
+    state of an element item
+-------------------------------------------------*/
+
+static int get_view_item_state(render_target *target, const view_item *item)
+{
+	int state = 0;
+
+	if (item->output_name[0] != 0)
+		state = output_get_value(item->output_name);
+	else if (item->input_tag[0] != 0)
+	{
+		const input_field_config *field = input_field_by_tag_and_mask(target->machine->portconfig, item->input_tag, item->input_mask);
+		if (field != NULL)
+			state = ((input_port_read_safe(target->machine, item->input_tag, 0) ^ field->defvalue) & item->input_mask) ? 1 : 0;
+	}
+	return state;
+}
+
+
+/*-------------------------------------------------
+    add_layer_primitives - add primitives for
+    all the items in one layer of the view
+-------------------------------------------------*/
+
+static void add_layer_primitives(render_target *target, render_primitive_list *list, const object_transform *root_xform, int layer, int blendmode)
+{
+	view_item *item;
+
+	/* iterate over items in the layer */
+	for (item = target->curview->itemlist[layer]; item != NULL; item = item->next)
+	{
+		object_transform item_xform;
+		render_bounds bounds;
+
+		/* first apply orientation to the bounds */
+		bounds = item->bounds;
+		apply_orientation(&bounds, root_xform->orientation);
+		normalize_bounds(&bounds);
+
+		/* apply the transform to the item */
+		item_xform.xoffs = root_xform->xoffs + bounds.x0 * root_xform->xscale;
+		item_xform.yoffs = root_xform->yoffs + bounds.y0 * root_xform->yscale;
+		item_xform.xscale = (bounds.x1 - bounds.x0) * root_xform->xscale;
+		item_xform.yscale = (bounds.y1 - bounds.y0) * root_xform->yscale;
+		item_xform.color.r = item->color.r * root_xform->color.r;
+		item_xform.color.g = item->color.g * root_xform->color.g;
+		item_xform.color.b = item->color.b * root_xform->color.b;
+		item_xform.color.a = item->color.a * root_xform->color.a;
+		item_xform.orientation = orientation_add(item->orientation, root_xform->orientation);
+
+		/* if there is no associated element, it must be a screen element */
+		if (item->element != NULL)
+			add_element_primitives(target, list, &item_xform, item->element, get_view_item_state(target, item), blendmode);
+		else
+		{
+			render_container *container = get_screen_container_by_index(item->index);
+			add_container_primitives(target, list, &item_xform, container, blendmode);
+		}
+	}
+}
+
+
 /*-------------------------------------------------
     add_container_primitives - add primitives
     based on the container
@@ -1974,7 +2271,10 @@ static void release_render_list(render_primitive_list *list)
 
 static void add_container_primitives(render_target *target, render_primitive_list *list, const object_transform *xform, render_container *container, int blendmode)
 {
+	render_texture *runtexture = NULL;
 	object_transform container_xform;
+	render_texinfo runtexinfo = { 0 };
+	int runwidth = 0, runheight = 0;
 	render_bounds cliprect;
 	render_primitive *prim;
 	container_item *item;
@@ -2058,6 +2358,64 @@ static void add_container_primitives(render_target *target, render_primitive_lis
 				clipped = render_clip_line(&prim->bounds, &cliprect);
 				break;
 
+			case CONTAINER_ITEM_LINES:
+			{
+				int adjust = (container->brightness != 1.0f || container->contrast != 1.0f || container->gamma != 1.0f);
+				UINT32 segnum;
+
+				/* set the line batch type; the whole batch shares one width and set of flags */
+				prim->type = RENDER_PRIMITIVE_LINES;
+				prim->width = item->width * MIN(container_xform.xscale, container_xform.yscale);
+				prim->flags = item->flags;
+				prim->segments = alloc_array_or_die(render_line_segment, item->numsegments);
+
+				/* transform and clip each segment, dropping the ones that fall outside */
+				for (segnum = 0; segnum < item->numsegments; segnum++)
+				{
+					const render_line_segment *src = &item->segments[segnum];
+					render_line_segment *dst = &prim->segments[prim->numsegments];
+					render_bounds segbounds = src->bounds;
+
+					apply_orientation(&segbounds, container_xform.orientation);
+					dst->bounds.x0 = render_round_nearest(container_xform.xoffs + segbounds.x0 * container_xform.xscale);
+					dst->bounds.y0 = render_round_nearest(container_xform.yoffs + segbounds.y0 * container_xform.yscale);
+					dst->bounds.x1 = render_round_nearest(container_xform.xoffs + segbounds.x1 * container_xform.xscale);
+					dst->bounds.y1 = render_round_nearest(container_xform.yoffs + segbounds.y1 * container_xform.yscale);
+					if (render_clip_line(&dst->bounds, &cliprect))
+						continue;
+
+					/* a batch can run to thousands of segments, so use the lookup table rather than pow() */
+					dst->color.r = container_xform.color.r * src->color.r;
+					dst->color.g = container_xform.color.g * src->color.g;
+					dst->color.b = container_xform.color.b * src->color.b;
+					dst->color.a = container_xform.color.a * src->color.a;
+					if (adjust)
+					{
+						dst->color.r = apply_brightness_contrast_gamma_lookup(container, dst->color.r);
+						dst->color.g = apply_brightness_contrast_gamma_lookup(container, dst->color.g);
+						dst->color.b = apply_brightness_contrast_gamma_lookup(container, dst->color.b);
+						dst->color.a = apply_brightness_contrast_gamma_lookup(container, dst->color.a);
+					}
+
+					/* the primitive bounds enclose every segment */
+					if (prim->numsegments == 0)
+					{
+						prim->bounds = dst->bounds;
+						normalize_bounds(&prim->bounds);
+					}
+					else
+					{
+						prim->bounds.x0 = MIN(prim->bounds.x0, MIN(dst->bounds.x0, dst->bounds.x1));
+						prim->bounds.y0 = MIN(prim->bounds.y0, MIN(dst->bounds.y0, dst->bounds.y1));
+						prim->bounds.x1 = MAX(prim->bounds.x1, MAX(dst->bounds.x0, dst->bounds.x1));
+						prim->bounds.y1 = MAX(prim->bounds.y1, MAX(dst->bounds.y0, dst->bounds.y1));
+					}
+					prim->numsegments++;
+				}
+				clipped = (prim->numsegments == 0);
+				break;
+			}
+
 			case CONTAINER_ITEM_QUAD:
 				/* set the quad type */
 				prim->type = RENDER_PRIMITIVE_QUAD;
@@ -2072,17 +2430,42 @@ static void add_container_primitives(render_target *target, render_primitive_lis
 					int finalorient = orientation_add(PRIMFLAG_GET_TEXORIENT(item->flags), container_xform.orientation);
 
 					/* based on the swap values, get the scaled final texture */
-					width = (finalorient & ORIENTATION_SWAP_XY) ? (prim->bounds.y1 - prim->bounds.y0) : (prim->bounds.x1 - prim->bounds.x0);
-					height = (finalorient & ORIENTATION_SWAP_XY) ? (prim->bounds.x1 - prim->bounds.x0) : (prim->bounds.y1 - prim->bounds.y0);
+					if (item->internal & INTERNAL_FLAG_CHAR)
+					{
+						/* glyphs are pre-scaled into their atlas page, which is always used 1:1 */
+						width = item->texture->sbounds.max_x - item->texture->sbounds.min_x;
+						height = item->texture->sbounds.max_y - item->texture->sbounds.min_y;
+					}
+					else
+					{
+						width = (finalorient & ORIENTATION_SWAP_XY) ? (prim->bounds.y1 - prim->bounds.y0) : (prim->bounds.x1 - prim->bounds.x0);
+						height = (finalorient & ORIENTATION_SWAP_XY) ? (prim->bounds.x1 - prim->bounds.x0) : (prim->bounds.y1 - prim->bounds.y0);
+					}
 					width = MIN(width, target->maxtexwidth);
 					height = MIN(height, target->maxtexheight);
-					if (texture_get_scaled(item->texture, width, height, &prim->texture, &list->reflist))
+
+					/* runs of quads on the same texture at the same size (mostly text) only look it up once */
+					if (item->texture == runtexture && width == runwidth && height == runheight)
+						prim->texture = runtexinfo;
+					else if (texture_get_scaled(item->texture, width, height, &prim->texture, &list->reflist))
+					{
+						runtexture = item->texture;
+						runwidth = width;
+						runheight = height;
+						runtexinfo = prim->texture;
+					}
+					else
+						runtexture = NULL;
+
+					if (runtexture != NULL)
 					{
 						/* set the palette */
 						prim->texture.palette = texture_get_adjusted_palette(item->texture, container);
 
-						/* determine UV coordinates and apply clipping */
+						/* determine UV coordinates within the part of the texture we show, and apply clipping */
 						prim->texcoords = oriented_texcoords[finalorient];
+						if (item->internal & INTERNAL_FLAG_CHAR)
+							map_texcoords(&prim->texcoords, &item->texbounds);
 						clipped = render_clip_quad(&prim->bounds, &cliprect, &prim->texcoords);
 
 						/* apply the final orientation from the quad flags and then build up the final flags */
@@ -2416,6 +2799,88 @@ static void add_clear_extents(render_primitive_list *list)
 }
 
 
+/*-------------------------------------------------
+    make_primitive_opaque - switch a primitive
+    that covers part of the cleared area to a
+    non-blended one
+-------------------------------------------------*/
+
+static void make_primitive_opaque(render_primitive *prim)
+{
+	/* change the blendmode on the first primitive to be NONE */
+	if (PRIMFLAG_GET_BLENDMODE(prim->flags) == BLENDMODE_RGB_MULTIPLY)
+	{
+		/* RGB multiply will multiply against 0, leaving nothing */
+		set_render_color(&prim->color, 1.0f, 0.0f, 0.0f, 0.0f);
+		prim->texture.base = NULL;
+		prim->flags = (prim->flags & ~PRIMFLAG_BLENDMODE_MASK) | PRIMFLAG_BLENDMODE(BLENDMODE_NONE);
+	}
+	else
+	{
+		/* for alpha or add modes, we will blend against 0 or add to 0; treat it like none */
+		prim->flags = (prim->flags & ~PRIMFLAG_BLENDMODE_MASK) | PRIMFLAG_BLENDMODE(BLENDMODE_NONE);
+	}
+
+	/* since alpha is disabled, premultiply the RGB values and reset the alpha to 1.0 */
+	prim->color.r *= prim->color.a;
+	prim->color.g *= prim->color.a;
+	prim->color.b *= prim->color.a;
+	prim->color.a = 1.0f;
+}
+
+
+/*-------------------------------------------------
+    clear_extents_match - return TRUE if the
+    leading primitives of the list are the ones
+    the cached clear extents were computed from
+-------------------------------------------------*/
+
+static int clear_extents_match(render_target *target, const render_primitive_list *list)
+{
+	const render_primitive *prim = list->head;
+	int keynum;
+
+	if (target->clearwidth != target->width || target->clearheight != target->height)
+		return FALSE;
+
+	for (keynum = 0; keynum < target->clearkeycount; keynum++, prim = prim->next)
+	{
+		const clear_key *key = &target->clearkey[keynum];
+		if (prim == NULL || prim->type != key->type || prim->flags != key->flags ||
+			prim->bounds.x0 != key->bounds.x0 || prim->bounds.y0 != key->bounds.y0 ||
+			prim->bounds.x1 != key->bounds.x1 || prim->bounds.y1 != key->bounds.y1)
+			return FALSE;
+	}
+
+	/* if the scan ran off the end of the list last time, it must do so again */
+	return (!target->clearend || prim == NULL);
+}
+
+
+/*-------------------------------------------------
+    add_clear_key - remember a primitive that
+    the clear extents depend on
+-------------------------------------------------*/
+
+static void add_clear_key(render_target *target, const render_primitive *prim)
+{
+	clear_key *key;
+
+	/* grow the key list if we need to */
+	if (target->clearkeycount >= target->clearkeymax)
+	{
+		target->clearkeymax = (target->clearkeymax == 0) ? 16 : target->clearkeymax * 2;
+		target->clearkey = (clear_key *)realloc(target->clearkey, target->clearkeymax * sizeof(*target->clearkey));
+		assert_always(target->clearkey != NULL, "Out of memory for clear extent keys");
+	}
+
+	key = &target->clearkey[target->clearkeycount++];
+	key->type = prim->type;
+	key->flags = prim->flags;
+	key->bounds = prim->bounds;
+}
+
+
 /*-------------------------------------------------
     add_clear_and_optimize_primitive_list -
     optimize the primitive list
@@ -2424,17 +2889,34 @@ static void add_clear_extents(render_primitive_list *list)
 static void add_clear_and_optimize_primitive_list(render_target *target, render_primitive_list *list)
 {
 	render_primitive *prim;
+	int primnum;
+
+	/* if the leading primitives are the same as last frame, so are the extents */
+	if (clear_extents_match(target, list))
+	{
+		memcpy(clear_extents, target->clearextents, target->clearextentcount * sizeof(clear_extents[0]));
+		clear_extent_count = target->clearextentcount;
+		for (prim = list->head, primnum = 0; primnum < target->clearremoved; prim = prim->next, primnum++)
+			make_primitive_opaque(prim);
+		add_clear_extents(list);
+		return;
+	}
 
 	/* start with the assumption that we need to clear the whole screen */
 	init_clear_extents(target->width, target->height);
+	target->clearkeycount = 0;
+	primnum = 0;
 
 	/* scan the list until we hit an intersection quad or a line */
 	for (prim = list->head; prim != NULL; prim = prim->next)
 	{
+		add_clear_key(target, prim);
+
 		/* switch off the type */
 		switch (prim->type)
 		{
 			case RENDER_PRIMITIVE_LINE:
+			case RENDER_PRIMITIVE_LINES:
 				goto done;
 
 			case RENDER_PRIMITIVE_QUAD:
@@ -2447,37 +2929,182 @@ static void add_clear_and_optimize_primitive_list(render_target *target, render_
 				if (!remove_clear_extent(&prim->bounds))
 					goto done;
 
-				/* change the blendmode on the first primitive to be NONE */
-				if (PRIMFLAG_GET_BLENDMODE(prim->flags) == BLENDMODE_RGB_MULTIPLY)
-				{
-					/* RGB multiply will multiply against 0, leaving nothing */
-					set_render_color(&prim->color, 1.0f, 0.0f, 0.0f, 0.0f);
-					prim->texture.base = NULL;
-					prim->flags = (prim->flags & ~PRIMFLAG_BLENDMODE_MASK) | PRIMFLAG_BLENDMODE(BLENDMODE_NONE);
-				}
-				else
-				{
-					/* for alpha or add modes, we will blend against 0 or add to 0; treat it like none */
-					prim->flags = (prim->flags & ~PRIMFLAG_BLENDMODE_MASK) | PRIMFLAG_BLENDMODE(BLENDMODE_NONE);
-				}
-
-				/* since alpha is disabled, premultiply the RGB values and reset the alpha to 1.0 */
-				prim->color.r *= prim->color.a;
-				prim->color.g *= prim->color.a;
-				prim->color.b *= prim->color.a;
-				prim->color.a = 1.0f;
+				make_primitive_opaque(prim);
+				primnum++;
 				break;
 			}
 		}
 	}
 
 done:
+	/* remember the result for next frame */
+	target->clearremoved = primnum;
+	target->clearend = (prim == NULL);
+	target->clearwidth = target->width;
+	target->clearheight = target->height;
+	target->clearextentcount = clear_extent_count;
+	memcpy(target->clearextents, clear_extents, clear_extent_count * sizeof(clear_extents[0]));
+
 	/* now add the extents to the clear list */
 	add_clear_extents(list);
 }
 
 
 
+/***************************************************************************
+    RETAINED PRIMITIVES
+***************************************************************************/
+
+/*-------------------------------------------------
+    retained_begin - start collecting the
+    signature of a retained list for this frame
+-------------------------------------------------*/
+
+static void retained_begin(render_target *target, retained_list *retained)
+{
+	retained->sigindex = 0;
+	retained->sigchanged = FALSE;
+
+	/* everything depends on the target geometry and view */
+	retained_add(retained, target->width);
+	retained_add(retained, target->height);
+	retained_add_float(retained, target->pixel_aspect);
+	retained_add(retained, target->orientation);
+	retained_add(retained, target->layerconfig);
+	retained_add_ptr(retained, target->curview);
+	retained_add(retained, target->maxtexwidth);
+	retained_add(retained, target->maxtexheight);
+
+	/* and on which background scales have completed */
+	retained_add(retained, scaled_generation);
+}
+
+
+/*-------------------------------------------------
+    retained_add_container - add the settings
+    and items of a container to the signature
+    of a retained list
+-------------------------------------------------*/
+
+static void retained_add_container(retained_list *retained, const render_container *container)
+{
+	const container_item *item;
+
+	retained_add(retained, container->orientation);
+	retained_add_float(retained, container->brightness);
+	retained_add_float(retained, container->contrast);
+	retained_add_float(retained, container->gamma);
+	retained_add_float(retained, container->xscale);
+	retained_add_float(retained, container->yscale);
+	retained_add_float(retained, container->xoffset);
+	retained_add_float(retained, container->yoffset);
+	retained_add_ptr(retained, container->overlaytexture);
+
+	for (item = container->itemlist; item != NULL; item = item->next)
+	{
+		/* unscaled and palettized textures can change without the item changing */
+		if (item->texture != NULL && (item->texture->scaler == NULL ||
+				item->texture->format == TEXFORMAT_PALETTE16 || item->texture->format == TEXFORMAT_PALETTEA16))
+			retained->sigchanged = TRUE;
+
+		retained_add(retained, item->type);
+		retained_add_float(retained, item->bounds.x0);
+		retained_add_float(retained, item->bounds.y0);
+		retained_add_float(retained, item->bounds.x1);
+		retained_add_float(retained, item->bounds.y1);
+		retained_add_float(retained, item->color.r);
+		retained_add_float(retained, item->color.g);
+		retained_add_float(retained, item->color.b);
+		retained_add_float(retained, item->color.a);
+		retained_add(retained, item->flags);
+		retained_add(retained, item->internal);
+		retained_add_float(retained, item->width);
+		retained_add_ptr(retained, item->texture);
+		retained_add_float(retained, item->texbounds.x0);
+		retained_add_float(retained, item->texbounds.y0);
+		retained_add_float(retained, item->texbounds.x1);
+		retained_add_float(retained, item->texbounds.y1);
+		retained_add(retained, item->numsegments);
+		if (item->numsegments != 0)
+		{
+			const UINT32 *segdata = (const UINT32 *)item->segments;
+			UINT32 words = item->numsegments * sizeof(*item->segments) / sizeof(*segdata);
+			UINT32 wordnum;
+
+			for (wordnum = 0; wordnum < words; wordnum++)
+				retained_add(retained, segdata[wordnum]);
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    retained_end - finish the signature; returns
+    TRUE if it matches the last frame, or else
+    discards the cached primitives
+-------------------------------------------------*/
+
+static int retained_end(retained_list *retained)
+{
+	if (retained->sigindex != retained->sigcount)
+		retained->sigchanged = TRUE;
+	retained->sigcount = retained->sigindex;
+
+	/* a change means the cached primitives are stale; build them again once it settles */
+	if (retained->sigchanged)
+	{
+		if (retained->valid)
+			release_render_list(&retained->list);
+		retained->valid = FALSE;
+		return FALSE;
+	}
+	return TRUE;
+}
+
+
+/*-------------------------------------------------
+    retained_append - append copies of the cached
+    primitives and references to a list
+-------------------------------------------------*/
+
+static void retained_append(render_primitive_list *list, const retained_list *retained)
+{
+	const render_primitive *prim;
+	const render_ref *ref;
+
+	for (prim = retained->list.head; prim != NULL; prim = prim->next)
+	{
+		render_primitive *copy = alloc_render_primitive(prim->type);
+		*copy = *prim;
+		copy->next = NULL;
+		if (prim->numsegments != 0)
+		{
+			copy->segments = alloc_array_or_die(render_line_segment, prim->numsegments);
+			memcpy(copy->segments, prim->segments, prim->numsegments * sizeof(*copy->segments));
+		}
+		append_render_primitive(list, copy);
+	}
+
+	/* the references are already unique within the cached list */
+	for (ref = retained->list.reflist; ref != NULL; ref = ref->next)
+		link_render_ref(&list->reflist, ref->refptr);
+}
+
+
+/*-------------------------------------------------
+    retained_free - free a retained list
+-------------------------------------------------*/
+
+static void retained_free(retained_list *retained)
+{
+	release_render_list(&retained->list);
+	osd_lock_free(retained->list.lock);
+	if (retained->sig != NULL)
+		free(retained->sig);
+}
+
+
+
 /***************************************************************************
     RENDER REFERENCES
 ***************************************************************************/
@@ -2494,6 +3121,7 @@ static void invalidate_all_render_ref(void *refptr)
 
 	/* loop over targets */
 	for (target = targetlist; target != NULL; target = target->next)
+	{
 		for (listnum = 0; listnum < ARRAY_LENGTH(target->primlist); listnum++)
 		{
 			render_primitive_list *list = &target->primlist[listnum];
@@ -2502,6 +3130,20 @@ static void invalidate_all_render_ref(void *refptr)
 				release_render_list(list);
 			osd_lock_release(list->lock);
 		}
+
+		/* drop any retained primitives that use it; they will be rebuilt next frame */
+		for (listnum = 0; listnum < ARRAY_LENGTH(target->retained_layer); listnum++)
+			if (has_render_ref(target->retained_layer[listnum].list.reflist, refptr))
+			{
+				release_render_list(&target->retained_layer[listnum].list);
+				target->retained_layer[listnum].valid = FALSE;
+			}
+		if (has_render_ref(target->retained_ui.list.reflist, refptr))
+		{
+			release_render_list(&target->retained_ui.list);
+			target->retained_ui.valid = FALSE;
+		}
+	}
 }
 
 
@@ -2559,11 +3201,7 @@ void render_texture_free(render_texture *texture)
 
 	/* free all scaled versions */
 	for (scalenum = 0; scalenum < ARRAY_LENGTH(texture->scaled); scalenum++)
-		if (texture->scaled[scalenum].bitmap != NULL)
-		{
-			invalidate_all_render_ref(texture->scaled[scalenum].bitmap);
-			bitmap_free(texture->scaled[scalenum].bitmap);
-		}
+		texture_free_scaled(&texture->scaled[scalenum]);
 
 	/* invalidate references to the original bitmap as well */
 	if (texture->bitmap != NULL)
@@ -2599,6 +3237,9 @@ void render_texture_set_bitmap(render_texture *texture, bitmap_t *bitmap, const
 	if (format == TEXFORMAT_PALETTE16 || format == TEXFORMAT_PALETTEA16)
 		assert(palette != NULL);
 
+	/* make sure no background scale is still reading the old bitmap */
+	texture_wait_scaled(texture);
+
 	/* invalidate references to the old bitmap */
 	if (bitmap != texture->bitmap && texture->bitmap != NULL)
 		invalidate_all_render_ref(texture->bitmap);
@@ -2623,15 +3264,226 @@ void render_texture_set_bitmap(render_texture *texture, bitmap_t *bitmap, const
 
 	/* invalidate all scaled versions */
 	for (scalenum = 0; scalenum < ARRAY_LENGTH(texture->scaled); scalenum++)
+		texture_free_scaled(&texture->scaled[scalenum]);
+}
+
+
+/*-------------------------------------------------
+    scaled_lru_unlink - remove a scaled texture
+    from the LRU list
+-------------------------------------------------*/
+
+INLINE void scaled_lru_unlink(scaled_texture *scaled)
+{
+	if (scaled->lruprev != NULL)
+		scaled->lruprev->lrunext = scaled->lrunext;
+	else
+		scaled_lru_head = scaled->lrunext;
+	if (scaled->lrunext != NULL)
+		scaled->lrunext->lruprev = scaled->lruprev;
+	else
+		scaled_lru_tail = scaled->lruprev;
+	scaled->lruprev = scaled->lrunext = NULL;
+}
+
+
+/*-------------------------------------------------
+    scaled_lru_touch - move a scaled texture to
+    the most recently used end of the LRU list
+-------------------------------------------------*/
+
+INLINE void scaled_lru_touch(scaled_texture *scaled)
+{
+	if (scaled_lru_head == scaled)
+		return;
+	if (scaled->lruprev != NULL || scaled->lrunext != NULL || scaled_lru_tail == scaled)
+		scaled_lru_unlink(scaled);
+
+	scaled->lrunext = scaled_lru_head;
+	if (scaled_lru_head != NULL)
+		scaled_lru_head->lruprev = scaled;
+	else
+		scaled_lru_tail = scaled;
+	scaled_lru_head = scaled;
+}
+
+
+/*-------------------------------------------------
+    texture_scale_callback - work callback that
+    scales a texture in the background
+-------------------------------------------------*/
+
+static void *texture_scale_callback(void *param, int threadid)
+{
+	scaled_texture *scaled = (scaled_texture *)param;
+	render_texture *texture = scaled->owner;
+
+	(*texture->scaler)(scaled->bitmap, texture->bitmap, &texture->sbounds, texture->param);
+	return NULL;
+}
+
+
+/*-------------------------------------------------
+    texture_finish_scaled - release the work item
+    for a completed background scale
+-------------------------------------------------*/
+
+static void texture_finish_scaled(scaled_texture *scaled)
+{
+	scaled_texture **curr;
+
+	osd_work_item_release(scaled->work);
+	scaled->work = NULL;
+
+	/* unlink from the pending list */
+	for (curr = &scaled_pending_list; *curr != NULL; curr = &(*curr)->pendnext)
+		if (*curr == scaled)
+		{
+			*curr = scaled->pendnext;
+			break;
+		}
+	scaled->pendnext = NULL;
+
+	/* anything built from a stand-in needs to be rebuilt */
+	scaled_generation++;
+}
+
+
+/*-------------------------------------------------
+    texture_poll_scaled - pick up any background
+    scales that have completed, optionally
+    waiting for all of them
+-------------------------------------------------*/
+
+static void texture_poll_scaled(int wait)
+{
+	scaled_texture *scaled, *next;
+
+	for (scaled = scaled_pending_list; scaled != NULL; scaled = next)
+	{
+		next = scaled->pendnext;
+		if (osd_work_item_wait(scaled->work, wait ? (100 * osd_ticks_per_second()) : 0))
+			texture_finish_scaled(scaled);
+	}
+}
+
+
+/*-------------------------------------------------
+    texture_wait_scaled - wait for any background
+    scales of a texture to complete
+-------------------------------------------------*/
+
+static void texture_wait_scaled(render_texture *texture)
+{
+	int scalenum;
+
+	for (scalenum = 0; scalenum < ARRAY_LENGTH(texture->scaled); scalenum++)
+		if (texture->scaled[scalenum].work != NULL)
+		{
+			osd_work_item_wait(texture->scaled[scalenum].work, 100 * osd_ticks_per_second());
+			texture_finish_scaled(&texture->scaled[scalenum]);
+		}
+}
+
+
+/*-------------------------------------------------
+    texture_free_scaled - free a scaled version
+    of a texture
+-------------------------------------------------*/
+
+static void texture_free_scaled(scaled_texture *scaled)
+{
+	/* let any background scale finish first */
+	if (scaled->work != NULL)
+	{
+		osd_work_item_wait(scaled->work, 100 * osd_ticks_per_second());
+		texture_finish_scaled(scaled);
+	}
+
+	if (scaled->bitmap != NULL)
+	{
+		invalidate_all_render_ref(scaled->bitmap);
+		scaled_bytes -= (UINT64)scaled->bitmap->width * scaled->bitmap->height * sizeof(UINT32);
+		bitmap_free(scaled->bitmap);
+		scaled_lru_unlink(scaled);
+	}
+	scaled->bitmap = NULL;
+	scaled->seqid = 0;
+}
+
+
+/*-------------------------------------------------
+    texture_scaled_in_use - return TRUE if any
+    primitive list refers to a bitmap
+-------------------------------------------------*/
+
+static int texture_scaled_in_use(bitmap_t *bitmap)
+{
+	render_target *target;
+	int listnum;
+
+	for (target = targetlist; target != NULL; target = target->next)
+	{
+		for (listnum = 0; listnum < ARRAY_LENGTH(target->primlist); listnum++)
+			if (has_render_ref(target->primlist[listnum].reflist, bitmap))
+				return TRUE;
+		for (listnum = 0; listnum < ARRAY_LENGTH(target->retained_layer); listnum++)
+			if (has_render_ref(target->retained_layer[listnum].list.reflist, bitmap))
+				return TRUE;
+		if (has_render_ref(target->retained_ui.list.reflist, bitmap))
+			return TRUE;
+	}
+	return FALSE;
+}
+
+
+/*-------------------------------------------------
+    texture_trim_scaled - free the least recently
+    used scaled textures until we are back within
+    the memory budget
+-------------------------------------------------*/
+
+static void texture_trim_scaled(void)
+{
+	scaled_texture *scaled, *prev;
+
+	for (scaled = scaled_lru_tail; scaled != NULL && scaled_bytes > MAX_SCALED_BYTES; scaled = prev)
 	{
-		if (texture->scaled[scalenum].bitmap != NULL)
+		prev = scaled->lruprev;
+		if (scaled->work == NULL && !texture_scaled_in_use(scaled->bitmap))
+			texture_free_scaled(scaled);
+	}
+}
+
+
+/*-------------------------------------------------
+    texture_find_standin - find the finished
+    scaled version closest in size to the one
+    requested
+-------------------------------------------------*/
+
+static scaled_texture *texture_find_standin(render_texture *texture, UINT32 dwidth, UINT32 dheight)
+{
+	scaled_texture *best = NULL;
+	UINT64 bestdiff = 0;
+	int scalenum;
+
+	for (scalenum = 0; scalenum < ARRAY_LENGTH(texture->scaled); scalenum++)
+	{
+		scaled_texture *scaled = &texture->scaled[scalenum];
+		if (scaled->bitmap != NULL && scaled->work == NULL)
 		{
-			invalidate_all_render_ref(texture->scaled[scalenum].bitmap);
-			bitmap_free(texture->scaled[scalenum].bitmap);
+			INT64 diff = (INT64)scaled->bitmap->width * scaled->bitmap->height - (INT64)dwidth * dheight;
+			if (diff < 0)
+				diff = -diff;
+			if (best == NULL || diff < bestdiff)
+			{
+				best = scaled;
+				bestdiff = diff;
+			}
 		}
-		texture->scaled[scalenum].bitmap = NULL;
-		texture->scaled[scalenum].seqid = 0;
 	}
+	return best;
 }
 
 
@@ -2658,17 +3510,7 @@ static int texture_get_scaled(render_texture *texture, UINT32 dwidth, UINT32 dhe
 
 	/* are we scaler-free? if so, just return the source bitmap */
 	if (texture->scaler == NULL || (texture->bitmap != NULL && swidth == dwidth && sheight == dheight))
-	{
-		/* add a reference and set up the source bitmap */
-		add_render_ref(reflist, texture->bitmap);
-		texinfo->base = (UINT8 *)texture->bitmap->base + (texture->sbounds.min_y * texture->bitmap->rowpixels + texture->sbounds.min_x) * (bpp / 8);
-		texinfo->rowpixels = texture->bitmap->rowpixels;
-		texinfo->width = swidth;
-		texinfo->height = sheight;
-		texinfo->palette = palbase;
-		texinfo->seqid = ++texture->curseq;
-		return TRUE;
-	}
+		goto use_source;
 
 	/* is it a size we already have? */
 	for (scalenum = 0; scalenum < ARRAY_LENGTH(texture->scaled); scalenum++)
@@ -2683,38 +3525,87 @@ static int texture_get_scaled(render_texture *texture, UINT32 dwidth, UINT32 dhe
 	/* did we get one? */
 	if (scalenum == ARRAY_LENGTH(texture->scaled))
 	{
+		scaled_texture *standin = texture_find_standin(texture, dwidth, dheight);
 		int lowest = -1;
 
-		/* didn't find one -- take the entry with the lowest seqnum */
+		/* didn't find one -- take the entry with the lowest seqnum, keeping any stand-in */
 		for (scalenum = 0; scalenum < ARRAY_LENGTH(texture->scaled); scalenum++)
-			if ((lowest == -1 || texture->scaled[scalenum].seqid < texture->scaled[lowest].seqid) && !has_render_ref(*reflist, texture->scaled[scalenum].bitmap))
+			if ((lowest == -1 || texture->scaled[scalenum].seqid < texture->scaled[lowest].seqid) && !has_render_ref(*reflist, texture->scaled[scalenum].bitmap) &&
+				texture->scaled[scalenum].work == NULL && (standin == NULL || &texture->scaled[scalenum] != standin))
 				lowest = scalenum;
 		assert_always(lowest != -1, "Too many live texture instances!");
 
 		/* throw out any existing entries */
 		scaled = &texture->scaled[lowest];
-		if (scaled->bitmap != NULL)
-		{
-			invalidate_all_render_ref(scaled->bitmap);
-			bitmap_free(scaled->bitmap);
-		}
+		texture_free_scaled(scaled);
 
 		/* allocate a new bitmap */
 		scaled->bitmap = bitmap_alloc(dwidth, dheight, BITMAP_FORMAT_ARGB32);
 		scaled->seqid = ++texture->curseq;
+		scaled->owner = texture;
+		scaled_bytes += (UINT64)dwidth * dheight * sizeof(UINT32);
+		scaled_lru_touch(scaled);
+
+		/* if there is something to show in the meantime, scale in the background */
+		if (scale_queue != NULL && (standin != NULL || texture->bitmap != NULL))
+		{
+			scaled->work = osd_work_item_queue(scale_queue, texture_scale_callback, scaled, 0);
+			if (scaled->work != NULL)
+			{
+				scaled->pendnext = scaled_pending_list;
+				scaled_pending_list = scaled;
+			}
+		}
+
+		/* otherwise, let the scaler do the work now */
+		if (scaled->work == NULL)
+			(*texture->scaler)(scaled->bitmap, texture->bitmap, &texture->sbounds, texture->param);
+	}
 
-		/* let the scaler do the work */
-		(*texture->scaler)(scaled->bitmap, texture->bitmap, &texture->sbounds, texture->param);
+	/* if the scale is still running, show the closest finished size or the source */
+	if (scaled->work != NULL)
+	{
+		if (osd_work_item_wait(scaled->work, 0))
+			texture_finish_scaled(scaled);
+		else
+		{
+			scaled_texture *standin = texture_find_standin(texture, dwidth, dheight);
+			if (standin != NULL)
+				scaled = standin;
+			else if (texture->bitmap != NULL)
+				goto use_source;
+			else
+			{
+				osd_work_item_wait(scaled->work, 100 * osd_ticks_per_second());
+				texture_finish_scaled(scaled);
+			}
+		}
 	}
 
 	/* finally fill out the new info */
+	scaled_lru_touch(scaled);
 	add_render_ref(reflist, scaled->bitmap);
 	texinfo->base = scaled->bitmap->base;
 	texinfo->rowpixels = scaled->bitmap->rowpixels;
-	texinfo->width = dwidth;
-	texinfo->height = dheight;
+	texinfo->width = scaled->bitmap->width;
+	texinfo->height = scaled->bitmap->height;
 	texinfo->palette = palbase;
 	texinfo->seqid = scaled->seqid;
+
+	/* keep the cache within its memory budget */
+	if (scaled_bytes > MAX_SCALED_BYTES)
+		texture_trim_scaled();
+	return TRUE;
+
+use_source:
+	/* add a reference and set up the source bitmap */
+	add_render_ref(reflist, texture->bitmap);
+	texinfo->base = (UINT8 *)texture->bitmap->base + (texture->sbounds.min_y * texture->bitmap->rowpixels + texture->sbounds.min_x) * (bpp / 8);
+	texinfo->rowpixels = texture->bitmap->rowpixels;
+	texinfo->width = swidth;
+	texinfo->height = sheight;
+	texinfo->palette = palbase;
+	texinfo->seqid = ++texture->curseq;
 	return TRUE;
 }
 
@@ -3050,6 +3941,7 @@ static container_item *render_container_item_add_generic(render_container *conta
 	item->color.g = (float)RGB_GREEN(argb) * (1.0f / 255.0f);
 	item->color.b = (float)RGB_BLUE(argb) * (1.0f / 255.0f);
 	item->color.a = (float)RGB_ALPHA(argb) * (1.0f / 255.0f);
+	item->texbounds.x1 = item->texbounds.y1 = 1.0f;
 
 	/* add the item to the container */
 	*container->nextitem = item;
@@ -3072,6 +3964,40 @@ void render_container_add_line(render_container *container, float x0, float y0,
 }
 
 
+/*-------------------------------------------------
+    render_container_add_lines - add a batch of
+    line segments to the specified container
+-------------------------------------------------*/
+
+void render_container_add_lines(render_container *container, const render_line_segment *segments, int count, float width, UINT32 flags)
+{
+	container_item *item;
+	int segnum;
+
+	if (count <= 0)
+		return;
+
+	/* the item bounds enclose the whole batch */
+	item = render_container_item_add_generic(container, CONTAINER_ITEM_LINES, segments[0].bounds.x0, segments[0].bounds.y0, segments[0].bounds.x1, segments[0].bounds.y1, MAKE_ARGB(0xff,0xff,0xff,0xff));
+	normalize_bounds(&item->bounds);
+	for (segnum = 1; segnum < count; segnum++)
+	{
+		const render_bounds *bounds = &segments[segnum].bounds;
+		item->bounds.x0 = MIN(item->bounds.x0, MIN(bounds->x0, bounds->x1));
+		item->bounds.y0 = MIN(item->bounds.y0, MIN(bounds->y0, bounds->y1));
+		item->bounds.x1 = MAX(item->bounds.x1, MAX(bounds->x0, bounds->x1));
+		item->bounds.y1 = MAX(item->bounds.y1, MAX(bounds->y0, bounds->y1));
+	}
+
+	/* keep our own copy of the segments */
+	item->segments = alloc_array_or_die(render_line_segment, count);
+	memcpy(item->segments, segments, count * sizeof(*item->segments));
+	item->numsegments = count;
+	item->width = width;
+	item->flags = flags;
+}
+
+
 /*-------------------------------------------------
     render_container_add_quad - add a quad item
     to the specified container
@@ -3092,18 +4018,33 @@ void render_container_add_quad(render_container *container, float x0, float y0,
 
 void render_container_add_char(render_container *container, float x0, float y0, float height, float aspect, rgb_t argb, render_font *font, UINT16 ch)
 {
+	render_bounds bounds, texbounds;
+	float xpixels = 0, ypixels = 0;
 	render_texture *texture;
-	render_bounds bounds;
 	container_item *item;
 
+	/* UI text is scaled to its final pixel size up front; work out how big a unit is */
+	if (container == ui_container && render_get_ui_target() != NULL)
+	{
+		render_target *target = render_get_ui_target();
+		int orientation = orientation_add(container->orientation, target->orientation);
+		xpixels = (float)((orientation & ORIENTATION_SWAP_XY) ? target->height : target->width) * container->xscale;
+		ypixels = (float)((orientation & ORIENTATION_SWAP_XY) ? target->width : target->height) * container->yscale;
+	}
+
 	/* compute the bounds of the character cell and get the texture */
 	bounds.x0 = x0;
 	bounds.y0 = y0;
-	texture = render_font_get_char_texture_and_bounds(font, height, aspect, ch, &bounds);
+	texture = render_font_get_char_texture_and_bounds(font, height, aspect, ch, xpixels, ypixels, &bounds, &texbounds);
 
-	/* add it like a quad */
- 	item = render_container_item_add_generic(container, CONTAINER_ITEM_QUAD, bounds.x0, bounds.y0, bounds.x1, bounds.y1, argb);
- 	item->texture = texture;
+	/* blank characters have nothing to draw */
+	if (texture == NULL)
+		return;
+
+	/* add it like a quad showing the glyph's part of the atlas */
+	item = render_container_item_add_generic(container, CONTAINER_ITEM_QUAD, bounds.x0, bounds.y0, bounds.x1, bounds.y1, argb);
+	item->texture = texture;
+	item->texbounds = texbounds;
 	item->flags = PRIMFLAG_TEXORIENT(ROT0) | PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA);
 	item->internal = INTERNAL_FLAG_CHAR;
 }
@@ -3212,19 +4153,18 @@ static void render_container_update_palette(render_container *container)
 		for (entry32 = mindirty / 32; entry32 <= maxdirty / 32; entry32++)
 		{
 			UINT32 dirtybits = dirty[entry32];
-			if (dirtybits != 0)
 
-				/* this chunk of 32 has dirty entries; fix them up */
-				for (entry = 0; entry < 32; entry++)
-					if (dirtybits & (1 << entry))
-					{
-						UINT32 finalentry = entry32 * 32 + entry;
-						rgb_t newval = adjusted_palette[finalentry];
-						container->bcglookup[finalentry] = (newval & 0xff000000) |
-													  container->bcglookup256[0x200 + RGB_RED(newval)] |
-													  container->bcglookup256[0x100 + RGB_GREEN(newval)] |
-													  container->bcglookup256[0x000 + RGB_BLUE(newval)];
-					}
+			/* this chunk of 32 has dirty entries; fix them up, stopping after the last one */
+			for (entry = 0; dirtybits != 0; entry++, dirtybits >>= 1)
+				if (dirtybits & 1)
+				{
+					UINT32 finalentry = entry32 * 32 + entry;
+					rgb_t newval = adjusted_palette[finalentry];
+					container->bcglookup[finalentry] = (newval & 0xff000000) |
+												  container->bcglookup256[0x200 + RGB_RED(newval)] |
+												  container->bcglookup256[0x100 + RGB_GREEN(newval)] |
+												  container->bcglookup256[0x000 + RGB_BLUE(newval)];
+				}
 		}
 	}
 }
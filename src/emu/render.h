@@ -64,7 +64,8 @@
 enum
 {
 	RENDER_PRIMITIVE_LINE,							/* a single line */
-	RENDER_PRIMITIVE_QUAD							/* a rectilinear quad */
+	RENDER_PRIMITIVE_QUAD,							/* a rectilinear quad */
+	RENDER_PRIMITIVE_LINES							/* a batch of line segments sharing width and flags */
 };
 
 
@@ -154,6 +155,7 @@ enum
 /* convenience macros for adding items to a screen container */
 #define render_screen_add_point(scr,x0,y0,diam,argb,flags)		render_container_add_line(render_container_get_screen(scr), x0, y0, x0, y0, diam, argb, flags)
 #define render_screen_add_line(scr,x0,y0,x1,y1,diam,argb,flags)	render_container_add_line(render_container_get_screen(scr), x0, y0, x1, y1, diam, argb, flags)
+#define render_screen_add_lines(scr,segs,count,diam,flags)		render_container_add_lines(render_container_get_screen(scr), segs, count, diam, flags)
 #define render_screen_add_rect(scr,x0,y0,x1,y1,argb,flags)		render_container_add_quad(render_container_get_screen(scr), x0, y0, x1, y1, argb, NULL, flags)
 #define render_screen_add_quad(scr,x0,y0,x1,y1,argb,tex,flags)	render_container_add_quad(render_container_get_screen(scr), x0, y0, x1, y1, argb, tex, flags)
 #define render_screen_add_char(scr,x0,y0,ht,asp,argb,font,ch)	render_container_add_char(render_container_get_screen(scr), x0, y0, ht, asp, argb, font, ch)
@@ -259,6 +261,19 @@ struct _render_texinfo
 };
 
 
+/*-------------------------------------------------
+    render_line_segment - one segment of a batch
+    of lines
+-------------------------------------------------*/
+
+typedef struct _render_line_segment render_line_segment;
+struct _render_line_segment
+{
+	render_bounds		bounds;				/* start and end points */
+	render_color		color;				/* RGBA values */
+};
+
+
 /*-------------------------------------------------
     render_primitive - a single low-level
     primitive for the rendering engine
@@ -275,6 +290,8 @@ struct _render_primitive
 	float				width;				/* width (for line primitives) */
 	render_texinfo		texture;			/* texture info (for quad primitives) */
 	render_quad_texuv	texcoords;			/* texture coordinates (for quad primitives) */
+	render_line_segment *segments;			/* segments (for line batch primitives) */
+	UINT32				numsegments;		/* number of segments (for line batch primitives) */
 };
 
 
@@ -404,6 +421,9 @@ void render_target_get_minimum_size(render_target *target, INT32 *minwidth, INT3
 /* return a list of primitives for a given render target */
 const render_primitive_list *render_target_get_primitives(render_target *target);
 
+/* return the texture of a list that is a single 1:1 RGB32 quad covering the target, or NULL */
+const render_texinfo *render_primitive_list_get_direct(const render_primitive_list *list, INT32 width, INT32 height);
+
 /* attempts to map a point on the specified render_target to the specified container, if possible */
 int render_target_map_point_container(render_target *target, INT32 target_x, INT32 target_y, render_container *container, float *container_x, float *container_y);
 
@@ -454,6 +474,9 @@ render_container *render_container_get_screen(const device_config *screen);
 /* add a line item to the specified container */
 void render_container_add_line(render_container *container, float x0, float y0, float x1, float y1, float width, rgb_t argb, UINT32 flags);
 
+/* add a batch of line segments sharing a width and flags to the specified container */
+void render_container_add_lines(render_container *container, const render_line_segment *segments, int count, float width, UINT32 flags);
+
 /* add a quad item to the specified container */
 void render_container_add_quad(render_container *container, float x0, float y0, float x1, float y1, rgb_t argb, render_texture *texture, UINT32 flags);
 
@@ -77,6 +77,18 @@
 
 
 
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* the target is split into horizontal bands of at least this many rows */
+#define BAND_HEIGHT			64
+
+/* and at most this many bands */
+#define MAX_BANDS			64
+
+
+
 /***************************************************************************
     TYPE DEFINITIONS
 ***************************************************************************/
@@ -91,6 +103,31 @@ struct _quad_setup_data
 };
 
 
+/* bilinear_row holds the state for filtering along an unrotated row */
+typedef struct _bilinear_row bilinear_row;
+struct _bilinear_row
+{
+	const render_texinfo *texture;			/* source texture */
+	INT32			rowoffs;				/* offset of the top source row */
+	INT32			v1;						/* offset from the top to the bottom source row */
+	UINT8			vfrac;					/* vertical filter weight */
+	INT32			lastu;					/* integral U of the cached texels */
+	rgb_t			pix00, pix01;			/* cached texels from the top row */
+	rgb_t			pix10, pix11;			/* cached texels from the bottom row */
+};
+
+
+typedef struct _band_data band_data;
+struct _band_data
+{
+	const render_primitive *primlist;		/* list of primitives to draw */
+	void *			dstdata;				/* destination base */
+	INT32			width, height;			/* size of the destination */
+	INT32			starty, endy;			/* rows covered by this band */
+	UINT32			pitch;					/* destination pitch */
+};
+
+
 
 /***************************************************************************
     GLOBAL VARIABLES
@@ -115,6 +152,40 @@ INLINE float round_nearest(float f)
 }
 
 
+/*-------------------------------------------------
+    init_cosine_table - build up the cosine table
+    used for antialiased lines if we haven't yet
+-------------------------------------------------*/
+
+INLINE void init_cosine_table(void)
+{
+	if (cosine_table[0] == 0)
+	{
+		int entry;
+		for (entry = 0; entry <= 2048; entry++)
+			cosine_table[entry] = (int)((double)(1.0 / cos(atan((double)(entry) / 2048.0))) * 0x10000000 + 0.5);
+	}
+}
+
+
+/*-------------------------------------------------
+    primitive_in_band - return TRUE if a primitive
+    might touch any of the rows in a band
+-------------------------------------------------*/
+
+INLINE int primitive_in_band(const render_primitive *prim, const band_data *band)
+{
+	float y0 = MIN(prim->bounds.y0, prim->bounds.y1);
+	float y1 = MAX(prim->bounds.y0, prim->bounds.y1);
+	float margin = 1.0f;
+
+	/* antialiased lines spread out by up to the beam width */
+	if (prim->type == RENDER_PRIMITIVE_LINE || prim->type == RENDER_PRIMITIVE_LINES)
+		margin += 2.0f * MAX(prim->width, 1.0f);
+	return (y1 + margin >= (float)band->starty && y0 - margin < (float)band->endy);
+}
+
+
 /*------------------------------------------------------------------------
     ycc_to_rgb - convert YCC to RGB; the YCC pixel
     contains Y in the LSB, Cb << 8, and Cr << 16
@@ -473,6 +544,155 @@ INLINE UINT32 get_texel_argb32_bilinear(const render_texinfo *texture, INT32 cur
 }
 
 
+/*-------------------------------------------------
+    bilinear_row_setup - prepare to filter along
+    a row of texels at a fixed V; when upscaling,
+    consecutive pixels share the same four source
+    texels, so they are fetched only when the
+    integral U changes
+-------------------------------------------------*/
+
+INLINE void bilinear_row_setup(bilinear_row *row, const render_texinfo *texture, INT32 curv)
+{
+	INT32 v0, v1;
+
+	v0 = curv >> 16;
+	v1 = texture->rowpixels;
+	if (v0 < 0) v0 = v1 = 0;
+	else if (v0 + 1 >= texture->height) v0 = texture->height - 1, v1 = 0;
+
+	row->texture = texture;
+	row->rowoffs = v0 * texture->rowpixels;
+	row->v1 = v1;
+	row->vfrac = curv >> 8;
+
+	/* no U can shift down to this, so the first fetch always happens */
+	row->lastu = 0x7fffffff;
+	row->pix00 = row->pix01 = row->pix10 = row->pix11 = 0;
+}
+
+
+/*-------------------------------------------------
+    bilinear_row_u - clamp the integral U for a
+    row fetch, returning the horizontal step
+-------------------------------------------------*/
+
+INLINE INT32 bilinear_row_u(const bilinear_row *row, INT32 *u0)
+{
+	if (*u0 < 0)
+	{
+		*u0 = 0;
+		return 0;
+	}
+	if (*u0 + 1 >= row->texture->width)
+	{
+		*u0 = row->texture->width - 1;
+		return 0;
+	}
+	return 1;
+}
+
+
+/*-------------------------------------------------
+    get_row_texel_palette16_bilinear - return a
+    bilinear filtered texel along a row from a
+    palettized 16bpp source
+-------------------------------------------------*/
+
+INLINE UINT32 get_row_texel_palette16_bilinear(bilinear_row *row, INT32 curu)
+{
+	if ((curu >> 16) != row->lastu)
+	{
+		const UINT16 *texbase = (const UINT16 *)row->texture->base + row->rowoffs;
+		const rgb_t *palette = row->texture->palette;
+		INT32 u0 = row->lastu = curu >> 16;
+		INT32 u1 = bilinear_row_u(row, &u0);
+
+		texbase += u0;
+		row->pix00 = palette[texbase[0]];
+		row->pix01 = palette[texbase[u1]];
+		row->pix10 = palette[texbase[row->v1]];
+		row->pix11 = palette[texbase[u1 + row->v1]];
+	}
+	return rgb_bilinear_filter(row->pix00, row->pix01, row->pix10, row->pix11, curu >> 8, row->vfrac);
+}
+
+
+/*-------------------------------------------------
+    get_row_texel_rgb15_bilinear - return a
+    bilinear filtered texel along a row from a
+    15bpp RGB source
+-------------------------------------------------*/
+
+INLINE UINT32 get_row_texel_rgb15_bilinear(bilinear_row *row, INT32 curu)
+{
+	rgb_t filtered;
+
+	if ((curu >> 16) != row->lastu)
+	{
+		const UINT16 *texbase = (const UINT16 *)row->texture->base + row->rowoffs;
+		INT32 u0 = row->lastu = curu >> 16;
+		INT32 u1 = bilinear_row_u(row, &u0);
+
+		texbase += u0;
+		row->pix00 = ((texbase[0] & 0x7fe0) << 6) | (texbase[0] & 0x1f);
+		row->pix01 = ((texbase[u1] & 0x7fe0) << 6) | (texbase[u1] & 0x1f);
+		row->pix10 = ((texbase[row->v1] & 0x7fe0) << 6) | (texbase[row->v1] & 0x1f);
+		row->pix11 = ((texbase[u1 + row->v1] & 0x7fe0) << 6) | (texbase[u1 + row->v1] & 0x1f);
+	}
+	filtered = rgb_bilinear_filter(row->pix00, row->pix01, row->pix10, row->pix11, curu >> 8, row->vfrac);
+	return (filtered & 0x1f) | ((filtered & 0x1ff800) >> 6);
+}
+
+
+/*-------------------------------------------------
+    get_row_texel_rgb32_bilinear - return a
+    bilinear filtered texel along a row from a
+    32bpp RGB source
+-------------------------------------------------*/
+
+INLINE UINT32 get_row_texel_rgb32_bilinear(bilinear_row *row, INT32 curu)
+{
+	if ((curu >> 16) != row->lastu)
+	{
+		const UINT32 *texbase = (const UINT32 *)row->texture->base + row->rowoffs;
+		INT32 u0 = row->lastu = curu >> 16;
+		INT32 u1 = bilinear_row_u(row, &u0);
+
+		texbase += u0;
+		row->pix00 = texbase[0];
+		row->pix01 = texbase[u1];
+		row->pix10 = texbase[row->v1];
+		row->pix11 = texbase[u1 + row->v1];
+	}
+	return rgb_bilinear_filter(row->pix00, row->pix01, row->pix10, row->pix11, curu >> 8, row->vfrac);
+}
+
+
+/*-------------------------------------------------
+    get_row_texel_argb32_bilinear - return a
+    bilinear filtered texel along a row from a
+    32bpp ARGB source
+-------------------------------------------------*/
+
+INLINE UINT32 get_row_texel_argb32_bilinear(bilinear_row *row, INT32 curu)
+{
+	if ((curu >> 16) != row->lastu)
+	{
+		const UINT32 *texbase = (const UINT32 *)row->texture->base + row->rowoffs;
+		INT32 u0 = row->lastu = curu >> 16;
+		INT32 u1 = bilinear_row_u(row, &u0);
+
+		texbase += u0;
+		row->pix00 = texbase[0];
+		row->pix01 = texbase[u1];
+		row->pix10 = texbase[row->v1];
+		row->pix11 = texbase[u1 + row->v1];
+	}
+	return rgba_bilinear_filter(row->pix00, row->pix01, row->pix10, row->pix11, curu >> 8, row->vfrac);
+}
+
+
 #endif
 
 
@@ -514,10 +734,13 @@ INLINE UINT32 get_texel_argb32_bilinear(const render_texinfo *texture, INT32 cur
 
 /* direct 32-bit source to destination pixel conversion */
 #define SOURCE32_TO_DEST(pix)	DEST_ASSEMBLE_RGB(SOURCE32_R(pix), SOURCE32_G(pix), SOURCE32_B(pix))
+#define DEST_IS_RGB32			0
 #ifndef VARIABLE_SHIFT
 #if (SRCSHIFT_R == 0) && (SRCSHIFT_G == 0) && (SRCSHIFT_B == 0) && (DSTSHIFT_R == 16) && (DSTSHIFT_G == 8) && (DSTSHIFT_B == 0)
 #undef SOURCE32_TO_DEST
 #define SOURCE32_TO_DEST(pix)	(pix)
+#undef DEST_IS_RGB32
+#define DEST_IS_RGB32			1
 #endif
 #endif
 
@@ -541,10 +764,18 @@ INLINE UINT32 get_texel_argb32_bilinear(const render_texinfo *texture, INT32 cur
 
 INLINE void FUNC_PREFIX(draw_aa_pixel)(void *dstdata, UINT32 pitch, int x, int y, rgb_t col)
 {
+	PIXEL_TYPE *dest = (PIXEL_TYPE *)dstdata + y * pitch + x;
+#if DEST_IS_RGB32
+	/* standard 32bpp targets add and saturate all three components at once */
+	rgbint src, dst;
+
+	rgb_to_rgbint(&src, col);
+	rgb_to_rgbint(&dst, NO_DEST_READ ? 0 : *dest);
+	rgbint_add(&dst, &src);
+	*dest = rgbint_to_rgb_clamp(&dst);
+#else
 	UINT32 dpix, dr, dg, db;
-	PIXEL_TYPE *dest;
 
-	dest = (PIXEL_TYPE *)dstdata + y * pitch + x;
 	dpix = NO_DEST_READ ? 0 : *dest;
 	dr = SOURCE32_R(col) + DEST_R(dpix);
 	dg = SOURCE32_G(col) + DEST_G(dpix);
@@ -553,15 +784,22 @@ INLINE void FUNC_PREFIX(draw_aa_pixel)(void *dstdata, UINT32 pitch, int x, int y
 	dg = (dg | -(dg >> (8 - SRCSHIFT_G))) & (0xff >> SRCSHIFT_G);
 	db = (db | -(db >> (8 - SRCSHIFT_B))) & (0xff >> SRCSHIFT_B);
 	*dest = DEST_ASSEMBLE_RGB(dr, dg, db);
+#endif
 }
 
 
 /*-------------------------------------------------
-    draw_line - draw a line or point
+    draw_line_segment - draw a single line or
+    point within a band
 -------------------------------------------------*/
 
-static void FUNC_PREFIX(draw_line)(const render_primitive *prim, void *dstdata, INT32 width, INT32 height, UINT32 pitch)
+static void FUNC_PREFIX(draw_line_segment)(const render_bounds *bounds, const render_color *color, float linewidth, UINT32 flags, const band_data *band)
 {
+	void *dstdata = band->dstdata;
+	INT32 width = band->width;
+	INT32 starty = band->starty;
+	INT32 endy = band->endy;
+	UINT32 pitch = band->pitch;
 	int dx,dy,sx,sy,cx,cy,bwidth;
 	UINT8 a1;
 	int x1,x2,y1,y2;
@@ -570,25 +808,17 @@ static void FUNC_PREFIX(draw_line)(const render_primitive *prim, void *dstdata,
 	int beam;
 
 	/* compute the start/end coordinates */
-	x1 = (int)(prim->bounds.x0 * 65536.0f);
-	y1 = (int)(prim->bounds.y0 * 65536.0f);
-	x2 = (int)(prim->bounds.x1 * 65536.0f);
-	y2 = (int)(prim->bounds.y1 * 65536.0f);
+	x1 = (int)(bounds->x0 * 65536.0f);
+	y1 = (int)(bounds->y0 * 65536.0f);
+	x2 = (int)(bounds->x1 * 65536.0f);
+	y2 = (int)(bounds->y1 * 65536.0f);
 
 	/* handle color and intensity */
-	col = MAKE_RGB((int)(255.0f * prim->color.r * prim->color.a), (int)(255.0f * prim->color.g * prim->color.a), (int)(255.0f * prim->color.b * prim->color.a));
+	col = MAKE_RGB((int)(255.0f * color->r * color->a), (int)(255.0f * color->g * color->a), (int)(255.0f * color->b * color->a));
 
-	if (PRIMFLAG_GET_ANTIALIAS(prim->flags))
+	if (PRIMFLAG_GET_ANTIALIAS(flags))
 	{
-		/* build up the cosine table if we haven't yet */
-		if (cosine_table[0] == 0)
-		{
-			int entry;
-			for (entry = 0; entry <= 2048; entry++)
-				cosine_table[entry] = (int)((double)(1.0 / cos(atan((double)(entry) / 2048.0))) * 0x10000000 + 0.5);
-		}
-
-		beam = prim->width * 65536.0f;
+		beam = linewidth * 65536.0f;
 		if (beam < 0x00010000)
 			beam = 0x00010000;
 
@@ -612,19 +842,19 @@ static void FUNC_PREFIX(draw_line)(const render_primitive *prim, void *dstdata,
 				{
 					dx = bwidth;    /* init diameter of beam */
 					dy = y1 >> 16;
-					if (dy >= 0 && dy < height)
+					if (dy >= starty && dy < endy)
 						FUNC_PREFIX(draw_aa_pixel)(dstdata, pitch, x1, dy, Tinten(0xff & (~y1 >> 8), col));
 					dy++;
 					dx -= 0x10000 - (0xffff & y1); /* take off amount plotted */
 					a1 = (dx >> 8) & 0xff;   /* calc remainder pixel */
 					dx >>= 16;                   /* adjust to pixel (solid) count */
-					while (dx--)                 /* plot rest of pixels */
-					{
-						if (dy >= 0 && dy < height)
-							FUNC_PREFIX(draw_aa_pixel)(dstdata, pitch, x1, dy, col);
-						dy++;
-					}
-					if (dy >= 0 && dy < height)
+
+					/* plot the solid pixels, clipped to the band once up front */
+					for (cy = MAX(dy, starty), yy = MIN(dy + dx, endy); cy < yy; cy++)
+						FUNC_PREFIX(draw_aa_pixel)(dstdata, pitch, x1, cy, col);
+					dy += dx;
+
+					if (dy >= starty && dy < endy)
 						FUNC_PREFIX(draw_aa_pixel)(dstdata, pitch, x1, dy, Tinten(a1,col));
 				}
 				if (x1 == xx) break;
@@ -640,11 +870,16 @@ static void FUNC_PREFIX(draw_line)(const render_primitive *prim, void *dstdata,
 				dx--;
 			y1 >>= 16;
 			yy = y2 >> 16;
+
+			/* only the rows inside this band matter */
+			if ((sy > 0) ? (y1 >= endy || yy < starty) : (y1 < starty || yy >= endy))
+				return;
+
 			bwidth = mul_32x32_hi(beam << 4,cosine_table[abs(sx) >> 5]);
 			x1 -= bwidth >> 1; /* start back half the width */
 			for (;;)
 			{
-				if (y1 >= 0 && y1 < height)
+				if (y1 >= starty && y1 < endy)
 				{
 					dy = bwidth;    /* calc diameter of beam */
 					dx = x1 >> 16;
@@ -654,12 +889,12 @@ static void FUNC_PREFIX(draw_line)(const render_primitive *prim, void *dstdata,
 					dy -= 0x10000 - (0xffff & x1); /* take off amount plotted */
 					a1 = (dy >> 8) & 0xff;   /* remainder pixel */
 					dy >>= 16;                   /* adjust to pixel (solid) count */
-					while (dy--)                 /* plot rest of pixels */
-					{
-						if (dx >= 0 && dx < width)
-							FUNC_PREFIX(draw_aa_pixel)(dstdata, pitch, dx, y1, col);
-						dx++;
-					}
+
+					/* plot the solid pixels, clipped to the target once up front */
+					for (cx = MAX(dx, 0), xx = MIN(dx + dy, width); cx < xx; cx++)
+						FUNC_PREFIX(draw_aa_pixel)(dstdata, pitch, cx, y1, col);
+					dx += dy;
+
 					if (dx >= 0 && dx < width)
 						FUNC_PREFIX(draw_aa_pixel)(dstdata, pitch, dx, y1, Tinten(a1, col));
 				}
@@ -687,7 +922,7 @@ static void FUNC_PREFIX(draw_line)(const render_primitive *prim, void *dstdata,
 		{
 			for (;;)
 			{
-				if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height)
+				if (x1 >= 0 && x1 < width && y1 >= starty && y1 < endy)
 					FUNC_PREFIX(draw_aa_pixel)(dstdata, pitch, x1, y1, col);
 				if (x1 == x2) break;
 				x1 += sx;
@@ -703,7 +938,7 @@ static void FUNC_PREFIX(draw_line)(const render_primitive *prim, void *dstdata,
 		{
 			for (;;)
 			{
-				if (x1 >= 0 && x1 < width && y1 >= 0 && y1 < height)
+				if (x1 >= 0 && x1 < width && y1 >= starty && y1 < endy)
 					FUNC_PREFIX(draw_aa_pixel)(dstdata, pitch, x1, y1, col);
 				if (y1 == y2) break;
 				y1 += sy;
@@ -719,6 +954,39 @@ static void FUNC_PREFIX(draw_line)(const render_primitive *prim, void *dstdata,
 }
 
 
+/*-------------------------------------------------
+    draw_line - draw a line or point
+-------------------------------------------------*/
+
+static void FUNC_PREFIX(draw_line)(const render_primitive *prim, const band_data *band)
+{
+	FUNC_PREFIX(draw_line_segment)(&prim->bounds, &prim->color, prim->width, prim->flags, band);
+}
+
+
+/*-------------------------------------------------
+    draw_lines - draw a batch of line segments,
+    skipping any that miss the band entirely
+-------------------------------------------------*/
+
+static void FUNC_PREFIX(draw_lines)(const render_primitive *prim, const band_data *band)
+{
+	float margin = 1.0f + 2.0f * MAX(prim->width, 1.0f);
+	float top = (float)band->starty - margin;
+	float bottom = (float)band->endy + margin;
+	UINT32 segnum;
+
+	for (segnum = 0; segnum < prim->numsegments; segnum++)
+	{
+		const render_line_segment *seg = &prim->segments[segnum];
+
+		if (MAX(seg->bounds.y0, seg->bounds.y1) < top || MIN(seg->bounds.y0, seg->bounds.y1) >= bottom)
+			continue;
+		FUNC_PREFIX(draw_line_segment)(&seg->bounds, &seg->color, prim->width, prim->flags, band);
+	}
+}
+
+
 
 /***************************************************************************
     RECT RASTERIZERS
@@ -728,8 +996,11 @@ static void FUNC_PREFIX(draw_line)(const render_primitive *prim, void *dstdata,
     draw_rect - draw a solid rectangle
 -------------------------------------------------*/
 
-static void FUNC_PREFIX(draw_rect)(const render_primitive *prim, void *dstdata, INT32 width, INT32 height, UINT32 pitch)
+static void FUNC_PREFIX(draw_rect)(const render_primitive *prim, const band_data *band)
 {
+	void *dstdata = band->dstdata;
+	INT32 width = band->width;
+	UINT32 pitch = band->pitch;
 	render_bounds fpos = prim->bounds;
 	INT32 startx, starty, endx, endy;
 	INT32 x, y;
@@ -748,10 +1019,10 @@ static void FUNC_PREFIX(draw_rect)(const render_primitive *prim, void *dstdata,
 	if (startx >= width) startx = width;
 	if (endx < 0) endx = 0;
 	if (endx >= width) endx = width;
-	if (starty < 0) starty = 0;
-	if (starty >= height) starty = height;
-	if (endy < 0) endy = 0;
-	if (endy >= height) endy = height;
+	if (starty < band->starty) starty = band->starty;
+	if (starty >= band->endy) starty = band->endy;
+	if (endy < band->starty) endy = band->starty;
+	if (endy >= band->endy) endy = band->endy;
 
 	/* bail if nothing left */
 	if (fpos.x0 > fpos.x1 || fpos.y0 > fpos.y1)
@@ -857,6 +1128,22 @@ static void FUNC_PREFIX(draw_quad_palette16_none)(const render_primitive *prim,
 			INT32 curu = setup->startu + (y - setup->starty) * setup->dudy;
 			INT32 curv = setup->startv + (y - setup->starty) * setup->dvdy;
 
+#if BILINEAR_FILTER
+			/* unrotated rows filter between a fixed pair of source rows */
+			if (dvdx == 0)
+			{
+				bilinear_row row;
+				bilinear_row_setup(&row, &prim->texture, curv);
+				for (x = setup->startx; x < endx; x++)
+				{
+					UINT32 pix = get_row_texel_palette16_bilinear(&row, curu);
+					*dest++ = SOURCE32_TO_DEST(pix);
+					curu += dudx;
+				}
+				continue;
+			}
+#endif
+
 			/* loop over cols */
 			for (x = setup->startx; x < endx; x++)
 			{
@@ -1329,6 +1616,22 @@ static void FUNC_PREFIX(draw_quad_rgb15)(const render_primitive *prim, void *dst
 			/* no lookup case */
 			if (palbase == NULL)
 			{
+#if BILINEAR_FILTER
+				/* unrotated rows filter between a fixed pair of source rows */
+				if (dvdx == 0)
+				{
+					bilinear_row row;
+					bilinear_row_setup(&row, &prim->texture, curv);
+					for (x = setup->startx; x < endx; x++)
+					{
+						UINT32 pix = get_row_texel_rgb15_bilinear(&row, curu);
+						*dest++ = SOURCE15_TO_DEST(pix);
+						curu += dudx;
+					}
+					continue;
+				}
+#endif
+
 				/* loop over cols */
 				for (x = setup->startx; x < endx; x++)
 				{
@@ -1505,6 +1808,22 @@ static void FUNC_PREFIX(draw_quad_rgb32)(const render_primitive *prim, void *dst
 			/* no lookup case */
 			if (palbase == NULL)
 			{
+#if BILINEAR_FILTER
+				/* unrotated rows filter between a fixed pair of source rows */
+				if (dvdx == 0)
+				{
+					bilinear_row row;
+					bilinear_row_setup(&row, &prim->texture, curv);
+					for (x = setup->startx; x < endx; x++)
+					{
+						UINT32 pix = get_row_texel_rgb32_bilinear(&row, curu);
+						*dest++ = SOURCE32_TO_DEST(pix);
+						curu += dudx;
+					}
+					continue;
+				}
+#endif
+
 				/* loop over cols */
 				for (x = setup->startx; x < endx; x++)
 				{
@@ -1815,6 +2134,33 @@ static void FUNC_PREFIX(draw_quad_argb32_alpha)(const render_primitive *prim, vo
 			/* no lookup case */
 			if (palbase == NULL)
 			{
+#if BILINEAR_FILTER
+				/* unrotated rows filter between a fixed pair of source rows */
+				if (dvdx == 0)
+				{
+					bilinear_row row;
+					bilinear_row_setup(&row, &prim->texture, curv);
+					for (x = setup->startx; x < endx; x++)
+					{
+						UINT32 pix = get_row_texel_argb32_bilinear(&row, curu);
+						UINT32 ta = pix >> 24;
+						if (ta != 0)
+						{
+							UINT32 dpix = NO_DEST_READ ? 0 : *dest;
+							UINT32 invta = 0x100 - ta;
+							UINT32 r = (SOURCE32_R(pix) * ta + DEST_R(dpix) * invta) >> 8;
+							UINT32 g = (SOURCE32_G(pix) * ta + DEST_G(dpix) * invta) >> 8;
+							UINT32 b = (SOURCE32_B(pix) * ta + DEST_B(dpix) * invta) >> 8;
+
+							*dest = DEST_ASSEMBLE_RGB(r, g, b);
+						}
+						dest++;
+						curu += dudx;
+					}
+					continue;
+				}
+#endif
+
 				/* loop over cols */
 				for (x = setup->startx; x < endx; x++)
 				{
@@ -2221,8 +2567,12 @@ static void FUNC_PREFIX(draw_quad_argb32_add)(const render_primitive *prim, void
     drawing routine
 -------------------------------------------------*/
 
-static void FUNC_PREFIX(setup_and_draw_textured_quad)(const render_primitive *prim, void *dstdata, INT32 width, INT32 height, UINT32 pitch)
+static void FUNC_PREFIX(setup_and_draw_textured_quad)(const render_primitive *prim, const band_data *band)
 {
+	void *dstdata = band->dstdata;
+	INT32 width = band->width;
+	INT32 height = band->height;
+	UINT32 pitch = band->pitch;
 	float fdudx, fdvdx, fdudy, fdvdy;
 	quad_setup_data setup;
 
@@ -2270,6 +2620,16 @@ static void FUNC_PREFIX(setup_and_draw_textured_quad)(const render_primitive *pr
 		setup.startv -= 0x8000;
 	}
 
+	/* clip to the band, stepping U/V down to the first row we draw */
+	if (setup.starty < band->starty)
+	{
+		setup.startu += (band->starty - setup.starty) * setup.dudy;
+		setup.startv += (band->starty - setup.starty) * setup.dvdy;
+		setup.starty = band->starty;
+	}
+	if (setup.starty > band->endy) setup.starty = band->endy;
+	if (setup.endy > band->endy) setup.endy = band->endy;
+
 	/* render based on the texture coordinates */
 	switch (prim->flags & (PRIMFLAG_TEXFORMAT_MASK | PRIMFLAG_BLENDMODE_MASK))
 	{
@@ -2330,29 +2690,98 @@ static void FUNC_PREFIX(setup_and_draw_textured_quad)(const render_primitive *pr
 ***************************************************************************/
 
 /*-------------------------------------------------
-    draw_primitives - draw a series of primitives
-    using a software rasterizer
+    draw_band - draw all the primitives that
+    touch a single band of the target
 -------------------------------------------------*/
 
-static void FUNC_PREFIX(draw_primitives)(const render_primitive *primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch)
+static void FUNC_PREFIX(draw_band)(const band_data *band)
 {
 	const render_primitive *prim;
 
 	/* loop over the list and render each element */
-	for (prim = primlist; prim != NULL; prim = prim->next)
+	for (prim = band->primlist; prim != NULL; prim = prim->next)
+	{
+		/* skip anything that can't reach this band */
+		if (!primitive_in_band(prim, band))
+			continue;
+
 		switch (prim->type)
 		{
 			case RENDER_PRIMITIVE_LINE:
-				FUNC_PREFIX(draw_line)(prim, dstdata, width, height, pitch);
+				FUNC_PREFIX(draw_line)(prim, band);
+				break;
+
+			case RENDER_PRIMITIVE_LINES:
+				FUNC_PREFIX(draw_lines)(prim, band);
 				break;
 
 			case RENDER_PRIMITIVE_QUAD:
 				if (!prim->texture.base)
-					FUNC_PREFIX(draw_rect)(prim, dstdata, width, height, pitch);
+					FUNC_PREFIX(draw_rect)(prim, band);
 				else
-					FUNC_PREFIX(setup_and_draw_textured_quad)(prim, dstdata, width, height, pitch);
+					FUNC_PREFIX(setup_and_draw_textured_quad)(prim, band);
 				break;
 		}
+	}
+}
+
+
+/*-------------------------------------------------
+    band_callback - work item callback to draw a
+    single band
+-------------------------------------------------*/
+
+static void *FUNC_PREFIX(band_callback)(void *param, int threadid)
+{
+	FUNC_PREFIX(draw_band)((const band_data *)param);
+	return NULL;
+}
+
+
+/*-------------------------------------------------
+    draw_primitives - draw a series of primitives
+    using a software rasterizer; if a work queue
+    is provided, the target is split into bands
+    which are drawn in parallel, each one in
+    primitive order
+-------------------------------------------------*/
+
+static void FUNC_PREFIX(draw_primitives)(const render_primitive *primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, osd_work_queue *queue)
+{
+	band_data band[MAX_BANDS];
+	UINT32 bandheight, numbands, bandnum;
+
+	/* the line drawer can't build its table from multiple threads */
+	init_cosine_table();
+
+	/* figure out how to split up the target */
+	bandheight = MAX(BAND_HEIGHT, (height + MAX_BANDS - 1) / MAX_BANDS);
+	numbands = (height + bandheight - 1) / bandheight;
+	if (queue == NULL || numbands < 2)
+		numbands = 1;
+
+	/* fill in the bands */
+	for (bandnum = 0; bandnum < numbands; bandnum++)
+	{
+		band[bandnum].primlist = primlist;
+		band[bandnum].dstdata = dstdata;
+		band[bandnum].width = width;
+		band[bandnum].height = height;
+		band[bandnum].starty = bandnum * bandheight;
+		band[bandnum].endy = (bandnum == numbands - 1) ? height : (bandnum + 1) * bandheight;
+		band[bandnum].pitch = pitch;
+	}
+
+	/* a single band is just drawn directly */
+	if (numbands == 1)
+	{
+		FUNC_PREFIX(draw_band)(&band[0]);
+		return;
+	}
+
+	/* otherwise, farm the bands out and wait for them to finish */
+	osd_work_item_queue_multiple(queue, FUNC_PREFIX(band_callback), numbands, band, sizeof(band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(queue, osd_ticks_per_second() * 100);
 }
 
 
@@ -2378,6 +2807,7 @@ static void FUNC_PREFIX(draw_primitives)(const render_primitive *primlist, void
 
 #undef SOURCE15_TO_DEST
 #undef SOURCE32_TO_DEST
+#undef DEST_IS_RGB32
 
 #undef FUNC_PREFIX
 #undef PIXEL_TYPE
@@ -36,6 +36,9 @@
 #define CACHED_HEADER_SIZE		16
 #define CACHED_BDF_HASH_SIZE	1024
 
+#define GLYPH_PAGE_SIZE			256			/* width and height of a glyph atlas page */
+#define GLYPH_PAGE_PAD			2			/* empty texels left around each glyph */
+
 //mamep: command.dat symbols assigned to Unicode PUA U+E000
 #define COMMAND_UNICODE	(0xe000)
 #define MAX_GLYPH_FONT	(150)
@@ -51,6 +54,29 @@
     TYPE DEFINITIONS
 ***************************************************************************/
 
+/* a render_font_page is one page of the glyph atlas, packed in rows */
+typedef struct _render_font_page render_font_page;
+struct _render_font_page
+{
+	render_font_page *	next;				/* next page in the font */
+	bitmap_t *			bitmap;				/* ARGB32 bitmap holding the pre-scaled glyphs */
+	render_texture *	texture;			/* texture that hands out the bitmap 1:1 */
+	INT32				curx, cury;			/* where the next glyph goes */
+	INT32				rowheight;			/* height of the current row */
+};
+
+
+/* a render_font_glyph is one copy of a character, scaled to a pixel size and packed into a page */
+typedef struct _render_font_glyph render_font_glyph;
+struct _render_font_glyph
+{
+	render_font_glyph *	next;				/* next scaled copy of the same character */
+	INT32				width, height;		/* pixel size of this copy */
+	render_font_page *	page;				/* atlas page holding it */
+	INT32				pagex, pagey;		/* position of the copy within the page */
+};
+
+
 /* a render_font contains information about a single character in a font */
 typedef struct _render_font_char render_font_char;
 struct _render_font_char
@@ -60,7 +86,7 @@ struct _render_font_char
 	INT32				bmwidth, bmheight;	/* width and height of bitmap */
 	const char *		rawdata;			/* pointer to the raw data for this one */
 	bitmap_t *			bitmap;				/* pointer to the bitmap containing the raw data */
-	render_texture *	texture;			/* pointer to a texture for rendering and sizing */
+	render_font_glyph *	glyphlist;			/* scaled copies packed into the atlas */
 
 //mamep: for color glyph
 #ifdef UI_COLOR_DISPLAY
@@ -81,6 +107,11 @@ struct _render_font
 	const char *		rawdata;			/* pointer to the raw data for the font */
 	UINT64				rawsize;			/* size of the raw font data */
 
+	render_font_page *	pagelist;			/* glyph atlas pages, in allocation order */
+	render_font_page *	curpage;			/* page currently being filled */
+	float				glyphxscale;		/* pixel scale the atlas was built for */
+	float				glyphyscale;
+
 //mamep: for command glyph
 	render_font *		cmd;
 };
@@ -92,6 +123,8 @@ struct _render_font
 ***************************************************************************/
 
 static void render_font_char_expand(render_font *font, render_font_char *ch);
+static void render_font_free_glyphs(render_font_char *ch);
+static render_font_glyph *render_font_char_pack(render_font *font, render_font_char *ch, INT32 width, INT32 height);
 static int render_font_load_cached_bdf(render_font *font, const char *filename);
 static int render_font_load_bdf(render_font *font);
 static int render_font_load_cached(render_font *font, mame_file *file, UINT32 hash);
@@ -176,9 +209,6 @@ INLINE render_font_char *get_char(render_font *font, unicode_char chnum)
 
 			ch->bitmap = bitmap_alloc(ch->bmwidth, ch->bmheight, BITMAP_FORMAT_ARGB32);
 			render_texture_hq_scale(ch->bitmap, glyph_ch->bitmap, NULL, NULL);
-
-			ch->texture = render_texture_alloc(render_texture_hq_scale, NULL);
-			render_texture_set_bitmap(ch->texture, ch->bitmap, NULL, TEXFORMAT_ARGB32, NULL);
 		}
 		else
 			render_font_char_expand(font, ch);
@@ -319,8 +349,7 @@ void render_font_free(render_font *font)
 			for (charnum = 0; charnum < 256; charnum++)
 			{
 				render_font_char *ch = &font->chars[tablenum][charnum];
-				if (ch->texture != NULL)
-					render_texture_free(ch->texture);
+				render_font_free_glyphs(ch);
 				if (ch->bitmap != NULL)
 					bitmap_free(ch->bitmap);
 			}
@@ -329,6 +358,16 @@ void render_font_free(render_font *font)
 			free(font->chars[tablenum]);
 		}
 
+	/* free the glyph atlas */
+	while (font->pagelist != NULL)
+	{
+		render_font_page *page = font->pagelist;
+		font->pagelist = page->next;
+		render_texture_free(page->texture);
+		bitmap_free(page->bitmap);
+		free(page);
+	}
+
 	/* free the raw data and the size itself */
 	if (font->rawdata != NULL)
 		free((void *)font->rawdata);
@@ -416,10 +455,175 @@ static void render_font_char_expand(render_font *font, render_font_char *ch)
 			}
 		}
 	}
+}
+
+
+/*-------------------------------------------------
+    render_font_free_glyphs - free all the scaled
+    copies of a character
+-------------------------------------------------*/
+
+static void render_font_free_glyphs(render_font_char *ch)
+{
+	while (ch->glyphlist != NULL)
+	{
+		render_font_glyph *glyph = ch->glyphlist;
+		ch->glyphlist = glyph->next;
+		free(glyph);
+	}
+}
+
+
+/*-------------------------------------------------
+    render_font_page_scale - texture scaler for
+    an atlas page; the glyphs are already at
+    their final size, so this is normally a copy
+-------------------------------------------------*/
+
+static void render_font_page_scale(bitmap_t *dest, const bitmap_t *source, const rectangle *sbounds, void *param)
+{
+	render_font_page *page = (render_font_page *)param;
+	int y;
+
+	/* only a page larger than the maximum texture size gets resampled */
+	if (dest->width != page->bitmap->width || dest->height != page->bitmap->height)
+	{
+		render_texture_hq_scale(dest, page->bitmap, NULL, NULL);
+		return;
+	}
+
+	for (y = 0; y < dest->height; y++)
+		memcpy(BITMAP_ADDR32(dest, y, 0), BITMAP_ADDR32(page->bitmap, y, 0), dest->width * sizeof(UINT32));
+}
+
+
+/*-------------------------------------------------
+    render_font_page_invalidate - discard the
+    copies the renderer holds of a page before
+    its bitmap is modified
+-------------------------------------------------*/
+
+static void render_font_page_invalidate(render_font_page *page)
+{
+	rectangle bounds;
+
+	/* this waits for any pending copy and frees the stale ones; the next frame */
+	/* copies the page again synchronously, so there is never a stand-in */
+	bounds.min_x = bounds.min_y = 0;
+	bounds.max_x = page->bitmap->width;
+	bounds.max_y = page->bitmap->height;
+	render_texture_set_bitmap(page->texture, NULL, &bounds, TEXFORMAT_ARGB32, NULL);
+}
+
+
+/*-------------------------------------------------
+    render_font_page_reset - empty a page so it
+    can be packed again
+-------------------------------------------------*/
+
+static void render_font_page_reset(render_font_page *page)
+{
+	render_font_page_invalidate(page);
+	bitmap_fill(page->bitmap, NULL, 0);
+	page->curx = page->cury = GLYPH_PAGE_PAD;
+	page->rowheight = 0;
+}
+
+
+/*-------------------------------------------------
+    render_font_recycle_pages - forget all the
+    scaled glyphs and start packing the atlas
+    from its first page again
+-------------------------------------------------*/
+
+static void render_font_recycle_pages(render_font *font)
+{
+	render_font_page *page;
+	int tablenum, charnum;
+
+	for (tablenum = 0; tablenum < 256; tablenum++)
+		if (font->chars[tablenum] != NULL)
+			for (charnum = 0; charnum < 256; charnum++)
+				render_font_free_glyphs(&font->chars[tablenum][charnum]);
+
+	/* the pages and their textures stay allocated, so nothing is left dangling */
+	for (page = font->pagelist; page != NULL; page = page->next)
+		render_font_page_reset(page);
+	font->curpage = font->pagelist;
+}
+
+
+/*-------------------------------------------------
+    render_font_char_pack - scale an expanded
+    character to the pixel size it is drawn at
+    and copy it into the glyph atlas, so that
+    all text shares a handful of textures
+-------------------------------------------------*/
+
+static render_font_glyph *render_font_char_pack(render_font *font, render_font_char *ch, INT32 width, INT32 height)
+{
+	INT32 cellwidth = width + GLYPH_PAGE_PAD;
+	INT32 cellheight = height + GLYPH_PAGE_PAD;
+	render_font_page *page = font->curpage;
+	render_font_glyph *glyph;
+	int y;
+
+	/* move to the next row if this one is full */
+	if (page != NULL && page->curx + cellwidth > page->bitmap->width)
+	{
+		page->curx = GLYPH_PAGE_PAD;
+		page->cury += page->rowheight;
+		page->rowheight = 0;
+	}
+
+	/* move on to the next page if this one is full; oversized glyphs get a page to themselves */
+	while (page == NULL || page->curx + cellwidth > page->bitmap->width || page->cury + cellheight > page->bitmap->height)
+	{
+		render_font_page *next = (page != NULL) ? page->next : font->pagelist;
+
+		if (next == NULL)
+		{
+			next = alloc_clear_or_die(render_font_page);
+			next->bitmap = bitmap_alloc(MAX(GLYPH_PAGE_SIZE, cellwidth + GLYPH_PAGE_PAD), MAX(GLYPH_PAGE_SIZE, cellheight + GLYPH_PAGE_PAD), BITMAP_FORMAT_ARGB32);
+			next->texture = render_texture_alloc(render_font_page_scale, next);
+			render_font_page_reset(next);
+			if (page != NULL)
+				page->next = next;
+			else
+				font->pagelist = next;
+		}
+		page = next;
+	}
+	font->curpage = page;
+
+	/* glyphs already in the page never move, so only this page's copy goes stale */
+	render_font_page_invalidate(page);
+
+	/* copy the glyph in, scaling it if needed; the area is clear, which the resampler relies on */
+	if (width == ch->bitmap->width && height == ch->bitmap->height)
+	{
+		for (y = 0; y < height; y++)
+			memcpy(BITMAP_ADDR32(page->bitmap, page->cury + y, page->curx), BITMAP_ADDR32(ch->bitmap, y, 0), width * sizeof(UINT32));
+	}
+	else
+	{
+		render_color color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		render_resample_argb_bitmap_hq(BITMAP_ADDR32(page->bitmap, page->cury, page->curx), page->bitmap->rowpixels, width, height, ch->bitmap, NULL, &color);
+	}
 
-	/* wrap a texture around the bitmap */
-	ch->texture = render_texture_alloc(render_texture_hq_scale, NULL);
-	render_texture_set_bitmap(ch->texture, ch->bitmap, NULL, TEXFORMAT_ARGB32, NULL);
+	/* remember where it went */
+	glyph = alloc_clear_or_die(render_font_glyph);
+	glyph->width = width;
+	glyph->height = height;
+	glyph->page = page;
+	glyph->pagex = page->curx;
+	glyph->pagey = page->cury;
+	glyph->next = ch->glyphlist;
+	ch->glyphlist = glyph;
+
+	page->curx += cellwidth;
+	page->rowheight = MAX(page->rowheight, cellheight);
+	return glyph;
 }
 
 
@@ -436,14 +640,19 @@ INT32 render_font_get_pixel_height(render_font *font)
 
 /*-------------------------------------------------
     render_font_get_char_texture_and_bounds -
-    return the texture for a character and compute
-    the bounds of the final bitmap
+    return the atlas texture for a character and
+    compute the bounds of the final bitmap and
+    of the glyph within the texture; xpixels and
+    ypixels give the size of one unit in pixels,
+    or 0 if unknown
 -------------------------------------------------*/
 
-render_texture *render_font_get_char_texture_and_bounds(render_font *font, float height, float aspect, unicode_char chnum, render_bounds *bounds)
+render_texture *render_font_get_char_texture_and_bounds(render_font *font, float height, float aspect, unicode_char chnum, float xpixels, float ypixels, render_bounds *bounds, render_bounds *texbounds)
 {
 	render_font_char *ch = get_char(font, chnum);
 	float scale = font->scale * height;
+	render_font_glyph *glyph;
+	INT32 pixwidth, pixheight;
 
 	/* on entry, assume x0,y0 are the top,left coordinate of the cell and add */
 	/* the character bounding box to that position */
@@ -453,8 +662,43 @@ render_texture *render_font_get_char_texture_and_bounds(render_font *font, float
 	bounds->x1 = bounds->x0 + (float)ch->bmwidth * scale * aspect;
 	bounds->y1 = bounds->y0 + (float)font->height * scale;
 
-	/* return the texture */
-	return ch->texture;
+	/* nothing to draw for empty glyphs */
+	if (ch->bitmap == NULL)
+		return NULL;
+
+	/* glyphs are stored at the size they are drawn at; without a pixel scale use the native size */
+	if (xpixels > 0 && ypixels > 0)
+	{
+		/* a new pixel scale means the UI was resized; start over rather than keep every size seen */
+		if (xpixels != font->glyphxscale || ypixels != font->glyphyscale)
+		{
+			render_font_recycle_pages(font);
+			font->glyphxscale = xpixels;
+			font->glyphyscale = ypixels;
+		}
+		pixwidth = render_round_nearest((bounds->x1 - bounds->x0) * xpixels);
+		pixheight = render_round_nearest((bounds->y1 - bounds->y0) * ypixels);
+	}
+	else
+	{
+		pixwidth = ch->bitmap->width;
+		pixheight = ch->bitmap->height;
+	}
+	if (pixwidth <= 0 || pixheight <= 0)
+		return NULL;
+
+	/* find the copy at this size, or scale and pack a new one */
+	for (glyph = ch->glyphlist; glyph != NULL; glyph = glyph->next)
+		if (glyph->width == pixwidth && glyph->height == pixheight)
+			break;
+	if (glyph == NULL)
+		glyph = render_font_char_pack(font, ch, pixwidth, pixheight);
+
+	texbounds->x0 = (float)glyph->pagex / (float)glyph->page->bitmap->width;
+	texbounds->y0 = (float)glyph->pagey / (float)glyph->page->bitmap->height;
+	texbounds->x1 = (float)(glyph->pagex + pixwidth) / (float)glyph->page->bitmap->width;
+	texbounds->y1 = (float)(glyph->pagey + pixheight) / (float)glyph->page->bitmap->height;
+	return glyph->page->texture;
 }
 
 
@@ -949,10 +1193,7 @@ static int render_font_save_cached(render_font *font, const char *filename, UINT
 				if (bytes_written != dest - tempbuffer)
 					goto error;
 
-				/* free the bitmap and texture */
-				if (ch->texture != NULL)
-					render_texture_free(ch->texture);
-				ch->texture = NULL;
+				/* free the bitmap; nothing has been packed into the atlas yet */
 				bitmap_free(ch->bitmap);
 				ch->bitmap = NULL;
 			}
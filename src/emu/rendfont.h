@@ -24,7 +24,7 @@
 render_font *render_font_alloc(const char *filename);
 void render_font_free(render_font *font);
 INT32 render_font_get_pixel_height(render_font *font);
-render_texture *render_font_get_char_texture_and_bounds(render_font *font, float height, float aspect, unicode_char ch, render_bounds *bounds);
+render_texture *render_font_get_char_texture_and_bounds(render_font *font, float height, float aspect, unicode_char ch, float xpixels, float ypixels, render_bounds *bounds, render_bounds *texbounds);
 void render_font_get_scaled_bitmap_and_bounds(render_font *font, bitmap_t *dest, float height, float aspect, unicode_char chnum, rectangle *bounds);
 float render_font_get_char_width(render_font *font, float height, float aspect, unicode_char ch);
 //mamep: to render as fixed-width font
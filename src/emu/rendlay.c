@@ -62,6 +62,7 @@
 #include "output.h"
 #include "xmlfile.h"
 #include "png.h"
+#include "zlib.h"
 
 
 
@@ -117,6 +118,13 @@ enum
 	COMPONENT_TYPE_MAX
 };
 
+/* LED components are drawn with this pen for lit segments */
+#define LED_ON_PEN				MAKE_ARGB(0xff,0xff,0xff,0xff)
+
+/* compiled layout cache */
+#define LAYOUT_CACHE_VERSION	1
+#define LAYOUT_CACHE_MIN_SIZE	8192		/* smaller layouts parse faster than we can hash and load them */
+
 
 /***************************************************************************
     TYPE DEFINITIONS
@@ -139,6 +147,40 @@ struct _element_component
 };
 
 
+/* an led_atlas holds the reference rendering of an LED type, split by segment */
+typedef struct _led_atlas led_atlas;
+struct _led_atlas
+{
+	bitmap_t *			base;				/* ARGB32 reference image with all segments off */
+	bitmap_t *			segmap;				/* INDEXED8 map of the segment owning each pixel, plus 1 */
+};
+
+
+/* a layout_cache is a buffer holding a compiled layout file */
+typedef struct _layout_cache layout_cache;
+struct _layout_cache
+{
+	UINT8 *				data;				/* pointer to the data */
+	UINT32				length;				/* length of valid data */
+	UINT32				allocated;			/* allocated size of the buffer */
+	UINT32				offset;				/* current read offset */
+	int					error;				/* TRUE if we read past the end */
+};
+
+
+
+/***************************************************************************
+    GLOBAL VARIABLES
+***************************************************************************/
+
+/* number of segments in each LED component type, including points and tails */
+static const UINT8 led_segment_count[COMPONENT_TYPE_MAX] = { 0, 0, 0, 0, 8, 14, 16, 16, 18 };
+
+/* segment atlases, shared by all loaded layout files */
+static led_atlas led_atlas_list[COMPONENT_TYPE_MAX];
+static int layout_file_count;
+
+
 
 /***************************************************************************
     FUNCTION PROTOTYPES
@@ -149,13 +191,18 @@ static void layout_element_scale(bitmap_t *dest, const bitmap_t *source, const r
 static void layout_element_draw_rect(bitmap_t *dest, const rectangle *bounds, const render_color *color);
 static void layout_element_draw_disk(bitmap_t *dest, const rectangle *bounds, const render_color *color);
 static void layout_element_draw_text(bitmap_t *dest, const rectangle *bounds, const render_color *color, const char *string);
-static void layout_element_draw_led7seg(bitmap_t *dest, const rectangle *bounds, const render_color *color, int state);
-static void layout_element_draw_led14seg(bitmap_t *dest, const rectangle *bounds, const render_color *color, int state);
-static void layout_element_draw_led16seg(bitmap_t *dest, const rectangle *bounds, const render_color *color, int state);
-static void layout_element_draw_led14segsc(bitmap_t *dest, const rectangle *bounds, const render_color *color, int state);
-static void layout_element_draw_led16segsc(bitmap_t *dest, const rectangle *bounds, const render_color *color, int state);
+static void layout_element_draw_led(bitmap_t *dest, const render_color *color, int type, int pattern);
+static bitmap_t *draw_led7seg_source(int pattern);
+static bitmap_t *draw_led14seg_source(int pattern);
+static bitmap_t *draw_led16seg_source(int pattern);
+static bitmap_t *draw_led14segsc_source(int pattern);
+static bitmap_t *draw_led16segsc_source(int pattern);
+static led_atlas *led_atlas_get(int type);
+static void led_atlas_free_all(void);
 
 /* layout file parsing */
+static layout_file *layout_file_parse(const machine_config *config, xml_data_node *rootnode, const char *dirname);
+static void layout_element_alloc_textures(layout_element *element);
 static layout_element *load_layout_element(const machine_config *config, xml_data_node *elemnode, const char *dirname);
 static element_component *load_element_component(const machine_config *config, xml_data_node *compnode, const char *dirname);
 static layout_view *load_layout_view(const machine_config *config, xml_data_node *viewnode, layout_element *elemlist);
@@ -167,6 +214,11 @@ static int load_orientation(const machine_config *config, xml_data_node *orientn
 static void layout_view_free(layout_view *view);
 static void layout_element_free(layout_element *element);
 
+/* compiled layout cache */
+static UINT32 layout_cache_hash(const machine_config *config, const char *source, const char *dirname);
+static void layout_file_save_cached(layout_file *file, const char *filename, UINT32 hash);
+static layout_file *layout_file_load_cached(const machine_config *config, const char *filename, UINT32 hash);
+
 
 
 /***************************************************************************
@@ -390,23 +442,11 @@ static void layout_element_scale(bitmap_t *dest, const bitmap_t *source, const r
 					break;
 
 				case COMPONENT_TYPE_LED7SEG:
-					layout_element_draw_led7seg(dest, &bounds, &component->color, elemtex->state);
-					break;
-
 				case COMPONENT_TYPE_LED14SEG:
-					layout_element_draw_led14seg(dest, &bounds, &component->color, elemtex->state);
-					break;
-
 				case COMPONENT_TYPE_LED16SEG:
-					layout_element_draw_led16seg(dest, &bounds, &component->color, elemtex->state);
-					break;
-
 				case COMPONENT_TYPE_LED14SEGSC:
-					layout_element_draw_led14segsc(dest, &bounds, &component->color, elemtex->state);
-					break;
-
 				case COMPONENT_TYPE_LED16SEGSC:
-					layout_element_draw_led16segsc(dest, &bounds, &component->color, elemtex->state);
+					layout_element_draw_led(dest, &component->color, component->type, elemtex->state);
 					break;
 			}
 		}
@@ -803,11 +843,11 @@ static void apply_skew(bitmap_t *dest, int skewwidth)
 
 
 /*-------------------------------------------------
-    layout_element_draw_led7seg - draw a
-    7-segment LCD
+    draw_led7seg_source - draw a 7-segment
+    LCD into a new reference-size bitmap
 -------------------------------------------------*/
 
-static void layout_element_draw_led7seg(bitmap_t *dest, const rectangle *bounds, const render_color *color, int pattern)
+static bitmap_t *draw_led7seg_source(int pattern)
 {
 	const rgb_t onpen = MAKE_ARGB(0xff,0xff,0xff,0xff);
 	const rgb_t offpen = MAKE_ARGB(0xff,0x20,0x20,0x20);
@@ -851,19 +891,16 @@ static void layout_element_draw_led7seg(bitmap_t *dest, const rectangle *bounds,
 	/* decimal point */
 	draw_segment_decimal(tempbitmap, bmwidth + segwidth/2, bmheight - segwidth/2, segwidth, (pattern & (1 << 7)) ? onpen : offpen);
 
-	/* resample to the target size */
-	render_resample_argb_bitmap_hq(dest->base, dest->rowpixels, dest->width, dest->height, tempbitmap, NULL, color);
-
-	bitmap_free(tempbitmap);
+	return tempbitmap;
 }
 
 
 /*-------------------------------------------------
-    layout_element_draw_led14seg - draw a
-    14-segment LCD
+    draw_led14seg_source - draw a 14-segment
+    LCD into a new reference-size bitmap
 -------------------------------------------------*/
 
-static void layout_element_draw_led14seg(bitmap_t *dest, const rectangle *bounds, const render_color *color, int pattern)
+static bitmap_t *draw_led14seg_source(int pattern)
 {
 	const rgb_t onpen = MAKE_ARGB(0xff, 0xff, 0xff, 0xff);
 	const rgb_t offpen = MAKE_ARGB(0xff, 0x20, 0x20, 0x20);
@@ -957,19 +994,17 @@ static void layout_element_draw_led14seg(bitmap_t *dest, const rectangle *bounds
 	/* apply skew */
 	apply_skew(tempbitmap, 40);
 
-	/* resample to the target size */
-	render_resample_argb_bitmap_hq(dest->base, dest->rowpixels, dest->width, dest->height, tempbitmap, NULL, color);
-
-	bitmap_free(tempbitmap);
+	return tempbitmap;
 }
 
 
 /*-------------------------------------------------
-    layout_element_draw_led14segsc - draw a
+    draw_led14segsc_source - draw a
     14-segment LCD with semicolon (2 extra segments)
+    into a new reference-size bitmap
 -------------------------------------------------*/
 
-static void layout_element_draw_led14segsc(bitmap_t *dest, const rectangle *bounds, const render_color *color, int pattern)
+static bitmap_t *draw_led14segsc_source(int pattern)
 {
 	const rgb_t onpen = MAKE_ARGB(0xff, 0xff, 0xff, 0xff);
 	const rgb_t offpen = MAKE_ARGB(0xff, 0x20, 0x20, 0x20);
@@ -1072,19 +1107,16 @@ static void layout_element_draw_led14segsc(bitmap_t *dest, const rectangle *boun
 		bmheight - (segwidth), bmheight + segwidth*1.5,
 		segwidth/2, (pattern & (1 << 15)) ? onpen : offpen);
 
-	/* resample to the target size */
-	render_resample_argb_bitmap_hq(dest->base, dest->rowpixels, dest->width, dest->height, tempbitmap, NULL, color);
-
-	bitmap_free(tempbitmap);
+	return tempbitmap;
 }
 
 
 /*-------------------------------------------------
-    layout_element_draw_led16seg - draw a
-    16-segment LCD
+    draw_led16seg_source - draw a 16-segment
+    LCD into a new reference-size bitmap
 -------------------------------------------------*/
 
-static void layout_element_draw_led16seg(bitmap_t *dest, const rectangle *bounds, const render_color *color, int pattern)
+static bitmap_t *draw_led16seg_source(int pattern)
 {
 	const rgb_t onpen = MAKE_ARGB(0xff, 0xff, 0xff, 0xff);
 	const rgb_t offpen = MAKE_ARGB(0xff, 0x20, 0x20, 0x20);
@@ -1188,19 +1220,17 @@ static void layout_element_draw_led16seg(bitmap_t *dest, const rectangle *bounds
 	/* apply skew */
 	apply_skew(tempbitmap, 40);
 
-	/* resample to the target size */
-	render_resample_argb_bitmap_hq(dest->base, dest->rowpixels, dest->width, dest->height, tempbitmap, NULL, color);
-
-	bitmap_free(tempbitmap);
+	return tempbitmap;
 }
 
 
 /*-------------------------------------------------
-    layout_element_draw_led16segsc - draw a
+    draw_led16segsc_source - draw a
     16-segment LCD with semicolon (2 extra segments)
+    into a new reference-size bitmap
 -------------------------------------------------*/
 
-static void layout_element_draw_led16segsc(bitmap_t *dest, const rectangle *bounds, const render_color *color, int pattern)
+static bitmap_t *draw_led16segsc_source(int pattern)
 {
 	const rgb_t onpen = MAKE_ARGB(0xff, 0xff, 0xff, 0xff);
 	const rgb_t offpen = MAKE_ARGB(0xff, 0x20, 0x20, 0x20);
@@ -1313,6 +1343,134 @@ static void layout_element_draw_led16segsc(bitmap_t *dest, const rectangle *boun
 	/* apply skew */
 	apply_skew(tempbitmap, 40);
 
+	return tempbitmap;
+}
+
+
+
+/***************************************************************************
+    LED SEGMENT ATLASES
+***************************************************************************/
+
+/*-------------------------------------------------
+    draw_led_source - draw an LED component of
+    the given type into a new reference-size
+    bitmap
+-------------------------------------------------*/
+
+static bitmap_t *draw_led_source(int type, int pattern)
+{
+	switch (type)
+	{
+		case COMPONENT_TYPE_LED7SEG:	return draw_led7seg_source(pattern);
+		case COMPONENT_TYPE_LED14SEG:	return draw_led14seg_source(pattern);
+		case COMPONENT_TYPE_LED16SEG:	return draw_led16seg_source(pattern);
+		case COMPONENT_TYPE_LED14SEGSC:	return draw_led14segsc_source(pattern);
+		case COMPONENT_TYPE_LED16SEGSC:	return draw_led16segsc_source(pattern);
+	}
+	return NULL;
+}
+
+
+/*-------------------------------------------------
+    led_atlas_get - return the segment atlas for
+    an LED type, building it the first time
+
+    The reference bitmaps are drawn with every
+    segment overwriting what came before, so the
+    colour of each pixel depends only on the last
+    segment that touched it. We draw once with all
+    segments off to get the base image and once
+    per segment with just that segment lit; the
+    pixels that come out lit belong to it. Any
+    state can then be expanded from the atlas with
+    a single pass instead of redrawing segments.
+-------------------------------------------------*/
+
+static led_atlas *led_atlas_get(int type)
+{
+	led_atlas *atlas = &led_atlas_list[type];
+	int segnum, x, y;
+
+	if (atlas->base != NULL)
+		return atlas;
+
+	/* draw the base image with everything off */
+	atlas->base = draw_led_source(type, 0);
+	atlas->segmap = bitmap_alloc(atlas->base->width, atlas->base->height, BITMAP_FORMAT_INDEXED8);
+	bitmap_fill(atlas->segmap, NULL, 0);
+
+	/* then find the pixels owned by each segment */
+	for (segnum = 0; segnum < led_segment_count[type]; segnum++)
+	{
+		bitmap_t *source = draw_led_source(type, 1 << segnum);
+
+		for (y = 0; y < source->height; y++)
+		{
+			const UINT32 *src = BITMAP_ADDR32(source, y, 0);
+			UINT8 *dst = BITMAP_ADDR8(atlas->segmap, y, 0);
+
+			for (x = 0; x < source->width; x++)
+				if (src[x] == LED_ON_PEN)
+					dst[x] = segnum + 1;
+		}
+		bitmap_free(source);
+	}
+	return atlas;
+}
+
+
+/*-------------------------------------------------
+    led_atlas_free_all - free all LED segment
+    atlases
+-------------------------------------------------*/
+
+static void led_atlas_free_all(void)
+{
+	int type;
+
+	for (type = 0; type < COMPONENT_TYPE_MAX; type++)
+	{
+		led_atlas *atlas = &led_atlas_list[type];
+		if (atlas->base != NULL)
+			bitmap_free(atlas->base);
+		if (atlas->segmap != NULL)
+			bitmap_free(atlas->segmap);
+		atlas->base = atlas->segmap = NULL;
+	}
+}
+
+
+/*-------------------------------------------------
+    layout_element_draw_led - draw an LED
+    component in the given state from its
+    segment atlas
+-------------------------------------------------*/
+
+static void layout_element_draw_led(bitmap_t *dest, const render_color *color, int type, int pattern)
+{
+	led_atlas *atlas = &led_atlas_list[type];
+	bitmap_t *tempbitmap;
+	int x, y;
+
+	/* the atlas is built when the element is loaded */
+	assert(atlas->base != NULL);
+
+	/* expand the requested state */
+	tempbitmap = bitmap_alloc(atlas->base->width, atlas->base->height, BITMAP_FORMAT_ARGB32);
+	for (y = 0; y < tempbitmap->height; y++)
+	{
+		const UINT32 *base = BITMAP_ADDR32(atlas->base, y, 0);
+		const UINT8 *segmap = BITMAP_ADDR8(atlas->segmap, y, 0);
+		UINT32 *dst = BITMAP_ADDR32(tempbitmap, y, 0);
+
+		for (x = 0; x < tempbitmap->width; x++)
+		{
+			int seg = segmap[x];
+			dst[x] = (seg != 0 && (pattern & (1 << (seg - 1)))) ? LED_ON_PEN : base[x];
+		}
+	}
+
 	/* resample to the target size */
 	render_resample_argb_bitmap_hq(dest->base, dest->rowpixels, dest->width, dest->height, tempbitmap, NULL, color);
 
@@ -1467,20 +1625,22 @@ static float xml_get_attribute_float_with_subst(const machine_config *config, xm
 
 /*-------------------------------------------------
     layout_file_load - parse a layout XML file
-    into a layout_file
+    into a layout_file, going through the
+    compiled cache for large layouts
 -------------------------------------------------*/
 
-layout_file *layout_file_load(const machine_config *config, const char *dirname, const char *filename)
+layout_file *layout_file_load(const machine_config *config, const char *dirname, const char *filename, const char *cachename)
 {
-	xml_data_node *rootnode, *mamelayoutnode, *elemnode, *viewnode;
-	layout_element **elemnext;
-	layout_view **viewnext;
-	layout_file *file;
-	int version;
+	astring *cachefname = NULL;
+	xml_data_node *rootnode;
+	layout_file *file = NULL;
+	const char *source;
+	char *data = NULL;
+	UINT32 hash = 0;
 
 	/* if the first character of the "file" is an open brace, assume it is an XML string */
 	if (filename[0] == '<')
-		rootnode = xml_string_read(filename, NULL);
+		source = filename;
 
 	/* otherwise, assume it is a file */
 	else
@@ -1488,6 +1648,7 @@ layout_file *layout_file_load(const machine_config *config, const char *dirname,
 		file_error filerr;
 		mame_file *layoutfile;
 		astring *fname;
+		UINT32 length;
 
 		fname = astring_assemble_2(astring_alloc(), filename, ".lay");
 		if (dirname != NULL)
@@ -1500,16 +1661,62 @@ layout_file *layout_file_load(const machine_config *config, const char *dirname,
 
 		if (filerr != FILERR_NONE)
 			return NULL;
-		rootnode = xml_file_read(mame_core_file(layoutfile), NULL);
+
+		/* read the whole file; we need it in memory to hash it anyway */
+		length = mame_fsize(layoutfile);
+		data = alloc_array_or_die(char, length + 1);
+		length = mame_fread(layoutfile, data, length);
+		data[length] = 0;
 		mame_fclose(layoutfile);
+		source = data;
 	}
 
-	/* if unable to parse the file, just bail */
-	if (rootnode == NULL)
-		return NULL;
+	/* large layouts are compiled per driver; try that first */
+	if (cachename != NULL && strlen(source) >= LAYOUT_CACHE_MIN_SIZE)
+	{
+		hash = layout_cache_hash(config, source, dirname);
+		cachefname = astring_alloc();
+		astring_printf(cachefname, "%s" PATH_SEPARATOR "%08x.lyc", cachename, hash);
+		file = layout_file_load_cached(config, astring_c(cachefname), hash);
+	}
+
+	/* otherwise, parse the XML and compile it for next time */
+	if (file == NULL)
+	{
+		rootnode = xml_string_read(source, NULL);
+		if (rootnode != NULL)
+		{
+			file = layout_file_parse(config, rootnode, dirname);
+			xml_file_free(rootnode);
+			if (file != NULL && cachefname != NULL)
+				layout_file_save_cached(file, astring_c(cachefname), hash);
+		}
+	}
+
+	if (cachefname != NULL)
+		astring_free(cachefname);
+	if (data != NULL)
+		free(data);
+	return file;
+}
+
+
+/*-------------------------------------------------
+    layout_file_parse - convert a parsed layout
+    XML tree into a layout_file
+-------------------------------------------------*/
+
+static layout_file *layout_file_parse(const machine_config *config, xml_data_node *rootnode, const char *dirname)
+{
+	xml_data_node *mamelayoutnode, *elemnode, *viewnode;
+	layout_element **elemnext;
+	layout_view **viewnext;
+	layout_file *file;
+	int version;
 
 	/* allocate the layout group object first */
 	file = alloc_clear_or_die(layout_file);
+	layout_file_count++;
 
 	/* find the layout node */
 	mamelayoutnode = xml_get_sibling(rootnode->child, "mamelayout");
@@ -1549,12 +1756,10 @@ layout_file *layout_file_load(const machine_config *config, const char *dirname,
 		viewnext = &view->next;
 	}
 
-	xml_file_free(rootnode);
 	return file;
 
 error:
 	layout_file_free(file);
-	xml_file_free(rootnode);
 	return NULL;
 }
 
@@ -1574,7 +1779,6 @@ static layout_element *load_layout_element(const machine_config *config, xml_dat
 	float xscale, yscale;
 	float xoffs, yoffs;
 	const char *name;
-	int state;
 	int first;
 
 	/* allocate a new element */
@@ -1639,6 +1843,31 @@ static layout_element *load_layout_element(const machine_config *config, xml_dat
 		component->bounds.y1 = (component->bounds.y1 - yoffs) * yscale;
 	}
 
+	/* allocate the textures for the states */
+	layout_element_alloc_textures(element);
+	return element;
+
+error:
+	layout_element_free(element);
+	return NULL;
+}
+
+
+/*-------------------------------------------------
+    layout_element_alloc_textures - allocate the
+    per-state textures for an element
+-------------------------------------------------*/
+
+static void layout_element_alloc_textures(layout_element *element)
+{
+	element_component *component;
+	int state;
+
+	/* build the atlases for any LEDs now, so the scaler only ever reads them */
+	for (component = element->complist; component != NULL; component = component->next)
+		if (led_segment_count[component->type] != 0)
+			led_atlas_get(component->type);
+
 	/* allocate an array of element textures for the states */
 	element->elemtex = alloc_array_or_die(element_texture, element->maxstate + 1);
 	for (state = 0; state <= element->maxstate; state++)
@@ -1647,12 +1876,6 @@ static layout_element *load_layout_element(const machine_config *config, xml_dat
 		element->elemtex[state].state = state;
 		element->elemtex[state].texture = render_texture_alloc(layout_element_scale, &element->elemtex[state]);
 	}
-
-	return element;
-
-error:
-	layout_element_free(element);
-	return NULL;
 }
 
 
@@ -2050,6 +2273,10 @@ void layout_file_free(layout_file *file)
 
 	/* free the file itself */
 	free(file);
+
+	/* the LED atlases go with the last file */
+	if (--layout_file_count == 0)
+		led_atlas_free_all();
 }
 
 
@@ -2125,3 +2352,462 @@ static void layout_element_free(layout_element *element)
 		free((void *)element->name);
 	free(element);
 }
+
+
+
+/***************************************************************************
+    COMPILED LAYOUT CACHE
+***************************************************************************/
+
+/*-------------------------------------------------
+    layout_cache_hash - compute the key for a
+    compiled layout from everything that feeds
+    into parsing it
+-------------------------------------------------*/
+
+static UINT32 layout_cache_hash(const machine_config *config, const char *source, const char *dirname)
+{
+	const device_config *device;
+	UINT32 hash;
+
+	/* hash the XML and the directory that images are loaded from */
+	hash = crc32(0, (const UINT8 *)source, strlen(source));
+	if (dirname != NULL)
+		hash = crc32(hash, (const UINT8 *)dirname, strlen(dirname));
+
+	/* the screen geometry is substituted into attributes, so it counts too */
+	for (device = video_screen_first(config); device != NULL; device = video_screen_next(device))
+	{
+		const screen_config *scrconfig = (const screen_config *)device->inline_config;
+		UINT8 visarea[16];
+		int index;
+
+		for (index = 0; index < 4; index++)
+		{
+			INT32 value = (index == 0) ? scrconfig->visarea.min_x : (index == 1) ? scrconfig->visarea.max_x : (index == 2) ? scrconfig->visarea.min_y : scrconfig->visarea.max_y;
+			visarea[index * 4 + 0] = value >> 24;
+			visarea[index * 4 + 1] = value >> 16;
+			visarea[index * 4 + 2] = value >> 8;
+			visarea[index * 4 + 3] = value;
+		}
+		hash = crc32(hash, visarea, sizeof(visarea));
+	}
+	return hash;
+}
+
+
+/*-------------------------------------------------
+    layout_cache_write - append raw data to a
+    cache buffer
+-------------------------------------------------*/
+
+static void layout_cache_write(layout_cache *cache, const void *data, UINT32 length)
+{
+	/* grow the buffer as needed */
+	if (cache->length + length > cache->allocated)
+	{
+		UINT32 newsize = MAX(cache->allocated * 2, cache->length + length + 4096);
+		UINT8 *newdata = alloc_array_or_die(UINT8, newsize);
+		if (cache->data != NULL)
+		{
+			memcpy(newdata, cache->data, cache->length);
+			free(cache->data);
+		}
+		cache->data = newdata;
+		cache->allocated = newsize;
+	}
+
+	memcpy(&cache->data[cache->length], data, length);
+	cache->length += length;
+}
+
+
+/*-------------------------------------------------
+    layout_cache_write_int - append a 32-bit
+    big-endian value
+-------------------------------------------------*/
+
+static void layout_cache_write_int(layout_cache *cache, UINT32 value)
+{
+	UINT8 bytes[4];
+
+	bytes[0] = value >> 24;
+	bytes[1] = value >> 16;
+	bytes[2] = value >> 8;
+	bytes[3] = value;
+	layout_cache_write(cache, bytes, 4);
+}
+
+
+/*-------------------------------------------------
+    layout_cache_write_float - append a float
+    by its bit pattern
+-------------------------------------------------*/
+
+static void layout_cache_write_float(layout_cache *cache, float value)
+{
+	union { float f; UINT32 i; } bits;
+
+	bits.f = value;
+	layout_cache_write_int(cache, bits.i);
+}
+
+
+/*-------------------------------------------------
+    layout_cache_write_string - append a string,
+    which may be NULL
+-------------------------------------------------*/
+
+static void layout_cache_write_string(layout_cache *cache, const char *string)
+{
+	if (string == NULL)
+		layout_cache_write_int(cache, 0);
+	else
+	{
+		layout_cache_write_int(cache, strlen(string) + 1);
+		layout_cache_write(cache, string, strlen(string) + 1);
+	}
+}
+
+
+/*-------------------------------------------------
+    layout_cache_write_bounds/color - append
+    bounds and colors
+-------------------------------------------------*/
+
+static void layout_cache_write_bounds(layout_cache *cache, const render_bounds *bounds)
+{
+	layout_cache_write_float(cache, bounds->x0);
+	layout_cache_write_float(cache, bounds->y0);
+	layout_cache_write_float(cache, bounds->x1);
+	layout_cache_write_float(cache, bounds->y1);
+}
+
+static void layout_cache_write_color(layout_cache *cache, const render_color *color)
+{
+	layout_cache_write_float(cache, color->a);
+	layout_cache_write_float(cache, color->r);
+	layout_cache_write_float(cache, color->g);
+	layout_cache_write_float(cache, color->b);
+}
+
+
+/*-------------------------------------------------
+    layout_cache_read_int - read a 32-bit
+    big-endian value
+-------------------------------------------------*/
+
+static UINT32 layout_cache_read_int(layout_cache *cache)
+{
+	const UINT8 *bytes = &cache->data[cache->offset];
+
+	if (cache->error || cache->offset + 4 > cache->length)
+	{
+		cache->error = TRUE;
+		return 0;
+	}
+	cache->offset += 4;
+	return (bytes[0] << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
+}
+
+
+/*-------------------------------------------------
+    layout_cache_read_float - read a float by
+    its bit pattern
+-------------------------------------------------*/
+
+static float layout_cache_read_float(layout_cache *cache)
+{
+	union { float f; UINT32 i; } bits;
+
+	bits.i = layout_cache_read_int(cache);
+	return bits.f;
+}
+
+
+/*-------------------------------------------------
+    layout_cache_read_string - read an allocated
+    copy of a string, or NULL
+-------------------------------------------------*/
+
+static const char *layout_cache_read_string(layout_cache *cache)
+{
+	UINT32 length = layout_cache_read_int(cache);
+	const char *string;
+
+	if (length == 0 || cache->error)
+		return NULL;
+	if (length > cache->length - cache->offset || cache->data[cache->offset + length - 1] != 0)
+	{
+		cache->error = TRUE;
+		return NULL;
+	}
+	string = copy_string((const char *)&cache->data[cache->offset]);
+	cache->offset += length;
+	return string;
+}
+
+
+/*-------------------------------------------------
+    layout_cache_read_bounds/color - read bounds
+    and colors
+-------------------------------------------------*/
+
+static void layout_cache_read_bounds(layout_cache *cache, render_bounds *bounds)
+{
+	bounds->x0 = layout_cache_read_float(cache);
+	bounds->y0 = layout_cache_read_float(cache);
+	bounds->x1 = layout_cache_read_float(cache);
+	bounds->y1 = layout_cache_read_float(cache);
+}
+
+static void layout_cache_read_color(layout_cache *cache, render_color *color)
+{
+	color->a = layout_cache_read_float(cache);
+	color->r = layout_cache_read_float(cache);
+	color->g = layout_cache_read_float(cache);
+	color->b = layout_cache_read_float(cache);
+}
+
+
+/*-------------------------------------------------
+    layout_file_save_cached - write a compiled
+    version of a layout file
+-------------------------------------------------*/
+
+static void layout_file_save_cached(layout_file *file, const char *filename, UINT32 hash)
+{
+	layout_cache cache = { 0 };
+	layout_element *element;
+	element_component *component;
+	layout_view *view;
+	view_item *item;
+	mame_file *cachefile;
+	file_error filerr;
+	int count, layer;
+
+	/* header: magic, key and format version */
+	layout_cache_write(&cache, "layc", 4);
+	layout_cache_write_int(&cache, hash);
+	layout_cache_write_int(&cache, LAYOUT_CACHE_VERSION);
+
+	/* elements, with their already-normalized components */
+	for (count = 0, element = file->elemlist; element != NULL; element = element->next)
+		count++;
+	layout_cache_write_int(&cache, count);
+	for (element = file->elemlist; element != NULL; element = element->next)
+	{
+		layout_cache_write_string(&cache, element->name);
+		layout_cache_write_int(&cache, element->defstate);
+		layout_cache_write_int(&cache, element->maxstate);
+
+		for (count = 0, component = element->complist; component != NULL; component = component->next)
+			count++;
+		layout_cache_write_int(&cache, count);
+		for (component = element->complist; component != NULL; component = component->next)
+		{
+			layout_cache_write_int(&cache, component->type);
+			layout_cache_write_int(&cache, component->state);
+			layout_cache_write_bounds(&cache, &component->bounds);
+			layout_cache_write_color(&cache, &component->color);
+			layout_cache_write_string(&cache, component->string);
+			layout_cache_write_string(&cache, component->dirname);
+			layout_cache_write_string(&cache, component->imagefile);
+			layout_cache_write_string(&cache, component->alphafile);
+		}
+	}
+
+	/* views, with items referring to elements by index */
+	for (count = 0, view = file->viewlist; view != NULL; view = view->next)
+		count++;
+	layout_cache_write_int(&cache, count);
+	for (view = file->viewlist; view != NULL; view = view->next)
+	{
+		layout_cache_write_string(&cache, view->name);
+		layout_cache_write_bounds(&cache, &view->expbounds);
+
+		for (layer = 0; layer < ITEM_LAYER_MAX; layer++)
+		{
+			for (count = 0, item = view->itemlist[layer]; item != NULL; item = item->next)
+				count++;
+			layout_cache_write_int(&cache, count);
+			for (item = view->itemlist[layer]; item != NULL; item = item->next)
+			{
+				int elemindex = -1;
+
+				if (item->element != NULL)
+					for (elemindex = 0, element = file->elemlist; element != item->element; element = element->next)
+						elemindex++;
+
+				layout_cache_write_string(&cache, item->output_name);
+				layout_cache_write_string(&cache, item->input_tag);
+				layout_cache_write_int(&cache, elemindex);
+				layout_cache_write_int(&cache, item->index);
+				layout_cache_write_int(&cache, item->input_mask);
+				layout_cache_write_int(&cache, item->orientation);
+				layout_cache_write_bounds(&cache, &item->rawbounds);
+				layout_cache_write_color(&cache, &item->color);
+			}
+		}
+	}
+
+	/* write it out in one go */
+	filerr = mame_fopen(SEARCHPATH_CONFIG, filename, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS, &cachefile);
+	if (filerr == FILERR_NONE)
+	{
+		if (mame_fwrite(cachefile, cache.data, cache.length) != cache.length)
+			mame_printf_warning(_("Unable to write compiled layout %s\n"), filename);
+		mame_fclose(cachefile);
+	}
+	free(cache.data);
+}
+
+
+/*-------------------------------------------------
+    layout_file_load_cached - load a compiled
+    layout file, returning NULL if it is missing,
+    stale or damaged
+-------------------------------------------------*/
+
+static layout_file *layout_file_load_cached(const machine_config *config, const char *filename, UINT32 hash)
+{
+	layout_element **elemarray = NULL;
+	layout_cache cache = { 0 };
+	layout_element **elemnext;
+	layout_view **viewnext;
+	layout_file *file = NULL;
+	mame_file *cachefile;
+	file_error filerr;
+	UINT32 numelems, numviews, index;
+
+	/* read the whole file */
+	filerr = mame_fopen(SEARCHPATH_CONFIG, filename, OPEN_FLAG_READ, &cachefile);
+	if (filerr != FILERR_NONE)
+		return NULL;
+	cache.length = cache.allocated = mame_fsize(cachefile);
+	cache.data = alloc_array_or_die(UINT8, cache.length + 1);
+	index = mame_fread(cachefile, cache.data, cache.length);
+	mame_fclose(cachefile);
+	if (index != cache.length)
+		goto error;
+
+	/* validate the header */
+	if (cache.length < 12 || memcmp(cache.data, "layc", 4) != 0)
+		goto error;
+	cache.offset = 4;
+	if (layout_cache_read_int(&cache) != hash || layout_cache_read_int(&cache) != LAYOUT_CACHE_VERSION)
+		goto error;
+
+	file = alloc_clear_or_die(layout_file);
+	layout_file_count++;
+
+	/* rebuild the elements */
+	numelems = layout_cache_read_int(&cache);
+	if (numelems > cache.length)
+		goto error;
+	elemarray = alloc_array_or_die(layout_element *, numelems + 1);
+	elemnext = &file->elemlist;
+	for (index = 0; index < numelems; index++)
+	{
+		layout_element *element = alloc_clear_or_die(layout_element);
+		element_component **nextcomp = &element->complist;
+		UINT32 numcomps, compnum;
+
+		*elemnext = elemarray[index] = element;
+		elemnext = &element->next;
+
+		element->name = layout_cache_read_string(&cache);
+		element->defstate = (INT32)layout_cache_read_int(&cache);
+		element->maxstate = layout_cache_read_int(&cache);
+		numcomps = layout_cache_read_int(&cache);
+		if (cache.error || element->name == NULL || element->maxstate > 262143 || numcomps > cache.length)
+			goto error;
+
+		for (compnum = 0; compnum < numcomps; compnum++)
+		{
+			element_component *component = alloc_clear_or_die(element_component);
+
+			*nextcomp = component;
+			nextcomp = &component->next;
+
+			component->type = layout_cache_read_int(&cache);
+			component->state = (INT32)layout_cache_read_int(&cache);
+			layout_cache_read_bounds(&cache, &component->bounds);
+			layout_cache_read_color(&cache, &component->color);
+			component->string = layout_cache_read_string(&cache);
+			component->dirname = layout_cache_read_string(&cache);
+			component->imagefile = layout_cache_read_string(&cache);
+			component->alphafile = layout_cache_read_string(&cache);
+			if (cache.error || component->type < 0 || component->type >= COMPONENT_TYPE_MAX)
+				goto error;
+		}
+		layout_element_alloc_textures(element);
+	}
+
+	/* rebuild the views */
+	numviews = layout_cache_read_int(&cache);
+	viewnext = &file->viewlist;
+	for (index = 0; index < numviews && !cache.error; index++)
+	{
+		layout_view *view = alloc_clear_or_die(layout_view);
+		int layer;
+
+		*viewnext = view;
+		viewnext = &view->next;
+
+		view->name = layout_cache_read_string(&cache);
+		layout_cache_read_bounds(&cache, &view->expbounds);
+		if (view->name == NULL)
+			goto error;
+
+		for (layer = 0; layer < ITEM_LAYER_MAX; layer++)
+		{
+			UINT32 numitems = layout_cache_read_int(&cache);
+			view_item **itemnext = &view->itemlist[layer];
+			UINT32 itemnum;
+
+			for (itemnum = 0; itemnum < numitems && !cache.error; itemnum++)
+			{
+				view_item *item = alloc_clear_or_die(view_item);
+				INT32 elemindex;
+
+				*itemnext = item;
+				itemnext = &item->next;
+
+				item->output_name = layout_cache_read_string(&cache);
+				item->input_tag = layout_cache_read_string(&cache);
+				elemindex = (INT32)layout_cache_read_int(&cache);
+				item->index = (INT32)layout_cache_read_int(&cache);
+				item->input_mask = layout_cache_read_int(&cache);
+				item->orientation = layout_cache_read_int(&cache);
+				layout_cache_read_bounds(&cache, &item->rawbounds);
+				layout_cache_read_color(&cache, &item->color);
+				if (cache.error || item->output_name == NULL || item->input_tag == NULL || elemindex < -1 || elemindex >= (INT32)numelems)
+					goto error;
+
+				/* same side effects as parsing */
+				if (elemindex >= 0)
+					item->element = elemarray[elemindex];
+				if (item->output_name[0] != 0 && item->element != 0)
+					output_set_value(item->output_name, item->element->defstate);
+			}
+		}
+
+		/* recompute the data for the view */
+		layout_view_recompute(view, ~0);
+	}
+	if (cache.error)
+		goto error;
+
+	free(elemarray);
+	free(cache.data);
+	return file;
+
+error:
+	if (file != NULL)
+		layout_file_free(file);
+	if (elemarray != NULL)
+		free(elemarray);
+	free(cache.data);
+	return NULL;
+}
@@ -13,6 +13,12 @@
 #include "tilemap.h"
 #include "profiler.h"
 
+/* use SSE2 for the scanline rasterizers on 64-bit implementations, where it can be assumed */
+#if (defined(__SSE2__) && defined(PTR64))
+#include <emmintrin.h>
+#define TILEMAP_SSE2_SCANLINES
+#endif
+
 
 /***************************************************************************
     CONSTANTS
@@ -27,6 +33,17 @@
 /* maximum index in each array */
 #define MAX_PEN_TO_FLAGS				256
 
+/* multithreaded rendering: band limits and dirty tile batching */
+#define MIN_BAND_HEIGHT					16
+#define MAX_BANDS						8
+#define MIN_BATCH_TILES					32
+#define MAX_BATCHES						16
+
+/* automatic dirty tracking limits */
+#define MAX_BOUND_MEMORY				4
+#define MAX_BOUND_DEPENDENCIES			4
+#define BINDING_CHUNK_BYTES				64
+
 
 /***************************************************************************
     TYPE DEFINITIONS
@@ -55,6 +72,7 @@ typedef struct _blit_parameters blit_parameters;
 struct _blit_parameters
 {
 	bitmap_t *			bitmap;
+	bitmap_t *			priority;
 	rectangle			cliprect;
 	blitmask_func 		draw_masked;
 	blitopaque_func		draw_opaque;
@@ -65,6 +83,54 @@ struct _blit_parameters
 };
 
 
+/* a block of memory watched for changes, with a shadow copy of its last contents */
+typedef struct _tilemap_binding tilemap_binding;
+struct _tilemap_binding
+{
+	const UINT8 *				base;				/* pointer to the live memory */
+	UINT8 *						shadow;				/* copy as of the last check */
+	UINT32						bytes;				/* total size in bytes */
+	UINT32						stride;				/* bytes per memory index (memory bindings only) */
+};
+
+
+/* a dirty tile whose info has been fetched, waiting to be drawn to the pixmap */
+typedef struct _tile_pending tile_pending;
+struct _tile_pending
+{
+	tilemap_logical_index		logindex;			/* logical index of the tile */
+	UINT32						x0, y0;				/* pixel position within the pixmap */
+	const UINT8 *				pen_data;			/* pointer to the pen data */
+	const UINT8 *				mask_data;			/* pointer to the mask data, or NULL */
+	UINT32						palette_base;		/* palette base from the tile info */
+	UINT8						category;			/* category from the tile info */
+	UINT8						group;				/* group from the tile info */
+	UINT8						flags;				/* flags with the global flip applied */
+	UINT8						pen_mask;			/* pen mask from the tile info */
+};
+
+
+/* a batch of pending tiles handed to a work item */
+typedef struct _tile_batch tile_batch;
+struct _tile_batch
+{
+	tilemap *					tmap;				/* tilemap the tiles belong to */
+	UINT32						start;				/* first pending tile */
+	UINT32						count;				/* number of pending tiles */
+};
+
+
+/* a horizontal band of a tilemap draw handed to a work item */
+typedef struct _tilemap_band tilemap_band;
+struct _tilemap_band
+{
+	tilemap *					tmap;				/* tilemap being drawn */
+	blit_parameters				blit;				/* blit parameters clipped to the band */
+	UINT32						screen_width;		/* screen width for scroll computations */
+	UINT32						screen_height;		/* screen height for scroll computations */
+};
+
+
 /* core tilemap structure */
 struct _tilemap
 {
@@ -98,6 +164,9 @@ struct _tilemap
 	UINT8						all_tiles_clean;	/* true if all tiles are clean */
 	UINT32						palette_offset;		/* palette offset */
 	UINT32						pen_data_offset;	/* pen data offset */
+	UINT32						drawseq;			/* bumped whenever a draw of the watched area could produce different pixels */
+	UINT32						seqcol, seqcols;	/* tile columns of the watched area, wrapping */
+	UINT32						seqrow, seqrows;	/* tile rows of the watched area, wrapping */
 	UINT32						gfx_used;			/* bitmask of gfx items used */
 	UINT32						gfx_dirtyseq[MAX_GFX_ELEMENTS]; /* dirtyseq values from last check */
 
@@ -118,6 +187,16 @@ struct _tilemap
 	bitmap_t *					flagsmap;			/* per-pixel flags */
 	UINT8 *						tileflags;			/* per-tile flags */
 	UINT8 *						pen_to_flags; 		/* mapping of pens to flags */
+
+	/* automatic dirty tracking */
+	tilemap_binding				memory[MAX_BOUND_MEMORY]; /* tile memory watched for changes */
+	int							memory_count;		/* number of memory bindings */
+	tilemap_binding				depend[MAX_BOUND_DEPENDENCIES]; /* values that dirty the whole tilemap */
+	int							depend_count;		/* number of dependency bindings */
+
+	/* multithreaded rendering */
+	tile_pending *				pending;			/* dirty tiles waiting to be drawn */
+	UINT32						pending_count;		/* number of entries in the pending list */
 };
 
 
@@ -126,6 +205,7 @@ struct _tilemap_private
 	tilemap *		list;
 	tilemap **		tailptr;
 	int				instance;
+	osd_work_queue *work_queue;
 };
 
 
@@ -143,14 +223,26 @@ static void tilemap_dispose(tilemap *tmap);
 static void mappings_create(tilemap *tmap);
 static void mappings_update(tilemap *tmap);
 
+/* automatic dirty tracking */
+static void bindings_update(tilemap *tmap);
+
 /* tile rendering */
 static void pixmap_update(tilemap *tmap, const rectangle *cliprect);
+static void pixmap_update_visible(tilemap *tmap, const rectangle *cliprect, UINT32 width, UINT32 height);
+static void visible_tiles(tilemap *tmap, const rectangle *cliprect, UINT32 width, UINT32 height, UINT32 *firstcol, UINT32 *numcols, UINT32 *firstrow, UINT32 *numrows);
 static void tile_update(tilemap *tmap, tilemap_logical_index logindex, UINT32 cached_col, UINT32 cached_row);
+static void tile_fetch(tilemap *tmap, tilemap_logical_index logindex, UINT32 col, UINT32 row, tile_pending *tile);
+static UINT8 tile_render(tilemap *tmap, const tile_pending *tile);
+static void tile_flush_pending(tilemap *tmap);
+static void *tile_render_batch(void *param, int threadid);
 static UINT8 tile_draw(tilemap *tmap, const UINT8 *pendata, UINT32 x0, UINT32 y0, UINT32 palette_base, UINT8 category, UINT8 group, UINT8 flags, UINT8 pen_mask);
 static UINT8 tile_apply_bitmask(tilemap *tmap, const UINT8 *maskdata, UINT32 x0, UINT32 y0, UINT8 category, UINT8 flags);
 
 /* drawing helpers */
 static void configure_blit_parameters(blit_parameters *blit, tilemap *tmap, bitmap_t *dest, const rectangle *cliprect, UINT32 flags, UINT8 priority, UINT8 priority_mask);
+static void tilemap_draw_blit(tilemap *tmap, blit_parameters *blit);
+static void tilemap_draw_clipped(tilemap *tmap, blit_parameters *blit, UINT32 width, UINT32 height);
+static void *tilemap_draw_band(void *param, int threadid);
 static void tilemap_draw_instance(tilemap *tmap, const blit_parameters *blit, int xpos, int ypos);
 static void tilemap_draw_roz_core(tilemap *tmap, const blit_parameters *blit,
 		UINT32 startx, UINT32 starty, int incxx, int incxy, int incyx, int incyy, int wraparound);
@@ -275,6 +367,137 @@ INLINE int gfx_elements_changed(tilemap *tmap)
 }
 
 
+/*-------------------------------------------------
+    tile_is_watched - return true if a tile lies
+    in the area the draw sequence watches
+-------------------------------------------------*/
+
+INLINE int tile_is_watched(tilemap *tmap, tilemap_logical_index logindex)
+{
+	UINT32 col = logindex % tmap->cols;
+	UINT32 row = logindex / tmap->cols;
+	return ((col + tmap->cols - tmap->seqcol) % tmap->cols < tmap->seqcols && (row + tmap->rows - tmap->seqrow) % tmap->rows < tmap->seqrows);
+}
+
+
+/*-------------------------------------------------
+    scanline_priority_opaque - apply the priority
+    code to a run of pixels
+-------------------------------------------------*/
+
+INLINE void scanline_priority_opaque(UINT8 *pri, int count, UINT32 pcode)
+{
+	int i = 0;
+
+#ifdef TILEMAP_SSE2_SCANLINES
+	__m128i andmask = _mm_set1_epi8((char)(pcode >> 8));
+	__m128i ormask = _mm_set1_epi8((char)pcode);
+
+	/* 16 pixels at a time */
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i p = _mm_loadu_si128((const __m128i *)&pri[i]);
+		_mm_storeu_si128((__m128i *)&pri[i], _mm_or_si128(_mm_and_si128(p, andmask), ormask));
+	}
+#endif
+
+	for ( ; i < count; i++)
+		pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+}
+
+
+/*-------------------------------------------------
+    scanline_priority_masked - apply the priority
+    code to the pixels of a run that pass the mask
+-------------------------------------------------*/
+
+INLINE void scanline_priority_masked(UINT8 *pri, const UINT8 *maskptr, int mask, int value, int count, UINT32 pcode)
+{
+	int i = 0;
+
+#ifdef TILEMAP_SSE2_SCANLINES
+	__m128i andmask = _mm_set1_epi8((char)(pcode >> 8));
+	__m128i ormask = _mm_set1_epi8((char)pcode);
+	__m128i maskmask = _mm_set1_epi8((char)mask);
+	__m128i maskvalue = _mm_set1_epi8((char)value);
+
+	/* 16 pixels at a time; value always fits in a byte, since it comes from blit_parameters */
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i m = _mm_loadu_si128((const __m128i *)&maskptr[i]);
+		__m128i p = _mm_loadu_si128((const __m128i *)&pri[i]);
+		__m128i sel = _mm_cmpeq_epi8(_mm_and_si128(m, maskmask), maskvalue);
+		__m128i newp = _mm_or_si128(_mm_and_si128(p, andmask), ormask);
+		_mm_storeu_si128((__m128i *)&pri[i], _mm_or_si128(_mm_and_si128(sel, newp), _mm_andnot_si128(sel, p)));
+	}
+#endif
+
+	for ( ; i < count; i++)
+		if ((maskptr[i] & mask) == value)
+			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
+}
+
+
+/*-------------------------------------------------
+    scanline_copy_ind16 - copy a run of pixels to
+    a 16bpp indexed bitmap, adding the palette
+    offset
+-------------------------------------------------*/
+
+INLINE void scanline_copy_ind16(UINT16 *dest, const UINT16 *source, int count, int pal)
+{
+	int i = 0;
+
+#ifdef TILEMAP_SSE2_SCANLINES
+	__m128i palette = _mm_set1_epi16((short)pal);
+
+	/* 8 pixels at a time */
+	for ( ; i + 8 <= count; i += 8)
+	{
+		__m128i src = _mm_loadu_si128((const __m128i *)&source[i]);
+		_mm_storeu_si128((__m128i *)&dest[i], _mm_add_epi16(src, palette));
+	}
+#endif
+
+	for ( ; i < count; i++)
+		dest[i] = source[i] + pal;
+}
+
+
+/*-------------------------------------------------
+    scanline_copy_masked_ind16 - copy the pixels
+    of a run that pass the mask to a 16bpp
+    indexed bitmap, adding the palette offset
+-------------------------------------------------*/
+
+INLINE void scanline_copy_masked_ind16(UINT16 *dest, const UINT16 *source, const UINT8 *maskptr, int mask, int value, int count, int pal)
+{
+	int i = 0;
+
+#ifdef TILEMAP_SSE2_SCANLINES
+	__m128i palette = _mm_set1_epi16((short)pal);
+	__m128i maskmask = _mm_set1_epi8((char)mask);
+	__m128i maskvalue = _mm_set1_epi8((char)value);
+
+	/* 8 pixels at a time, widening the byte mask to words */
+	for ( ; i + 8 <= count; i += 8)
+	{
+		__m128i m = _mm_loadl_epi64((const __m128i *)&maskptr[i]);
+		__m128i sel = _mm_cmpeq_epi8(_mm_and_si128(m, maskmask), maskvalue);
+		__m128i src = _mm_add_epi16(_mm_loadu_si128((const __m128i *)&source[i]), palette);
+		__m128i dst = _mm_loadu_si128((const __m128i *)&dest[i]);
+		sel = _mm_unpacklo_epi8(sel, sel);
+		_mm_storeu_si128((__m128i *)&dest[i], _mm_or_si128(_mm_and_si128(sel, src), _mm_andnot_si128(sel, dst)));
+	}
+#endif
+
+	for ( ; i < count; i++)
+		if ((maskptr[i] & mask) == value)
+			dest[i] = source[i] + pal;
+}
+
+
+
 /***************************************************************************
     SYSTEM-WIDE MANAGEMENT
 ***************************************************************************/
@@ -299,6 +522,10 @@ void tilemap_init(running_machine *machine)
 		machine->tilemap_data->tailptr = &machine->tilemap_data->list;
 
 		machine->priority_bitmap = auto_bitmap_alloc(machine, screen_width, screen_height, BITMAP_FORMAT_INDEXED8);
+
+		/* create a work queue if we are to render in parallel */
+		if (options_get_bool(mame_options(), OPTION_MTTILEMAP))
+			machine->tilemap_data->work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
 		add_exit_callback(machine, tilemap_exit);
 	}
 }
@@ -355,6 +582,10 @@ tilemap *tilemap_create(running_machine *machine, tile_get_info_func tile_get_in
 	/* allocate the pixel data cache */
 	tmap->pixmap = bitmap_alloc(tmap->width, tmap->height, BITMAP_FORMAT_INDEXED16);
 
+	/* watch the whole map until someone asks for the draw sequence of a smaller area */
+	tmap->seqcols = tmap->cols;
+	tmap->seqrows = tmap->rows;
+
 	/* allocate transparency mapping data */
 	tmap->tileflags = alloc_array_or_die(UINT8, tmap->max_logical_index);
 	tmap->flagsmap = bitmap_alloc(tmap->width, tmap->height, BITMAP_FORMAT_INDEXED8);
@@ -362,6 +593,10 @@ tilemap *tilemap_create(running_machine *machine, tile_get_info_func tile_get_in
 	for (group = 0; group < TILEMAP_NUM_GROUPS; group++)
 		tilemap_map_pens_to_layer(tmap, group, 0, 0, TILEMAP_PIXEL_LAYER0);
 
+	/* allocate the pending tile list if we render in parallel */
+	if (machine->tilemap_data->work_queue != NULL)
+		tmap->pending = alloc_array_or_die(tile_pending, tmap->max_logical_index);
+
 	/* add us to the end of the list of tilemaps */
 	*machine->tilemap_data->tailptr = tmap;
 	machine->tilemap_data->tailptr = &tmap->next;
@@ -406,6 +641,8 @@ void tilemap_set_user_data(tilemap *tmap, void *user_data)
 
 void tilemap_set_palette_offset(tilemap *tmap, UINT32 offset)
 {
+	if (tmap->palette_offset != offset)
+		tmap->drawseq++;
 	tmap->palette_offset = offset;
 }
 
@@ -418,6 +655,8 @@ void tilemap_set_palette_offset(tilemap *tmap, UINT32 offset)
 
 void tilemap_set_enable(tilemap *tmap, int enable)
 {
+	if (tmap->enable != (enable != 0))
+		tmap->drawseq++;
 	tmap->enable = (enable != 0);
 }
 
@@ -433,6 +672,7 @@ void tilemap_set_flip(tilemap *tmap, UINT32 attributes)
 	if (tmap->attributes != attributes)
 	{
 		tmap->attributes = attributes;
+		tmap->drawseq++;
 		mappings_update(tmap);
 	}
 }
@@ -504,6 +744,56 @@ void tilemap_mark_all_tiles_dirty_all(running_machine *machine)
 }
 
 
+/*-------------------------------------------------
+    tilemap_bind_memory - watch a block of RAM
+    holding the tile data; each memory index owns
+    bytes_per_entry bytes, and tiles whose bytes
+    change are marked dirty before drawing
+-------------------------------------------------*/
+
+void tilemap_bind_memory(tilemap *tmap, const void *base, int bytes_per_entry)
+{
+	tilemap_binding *binding;
+
+	assert_always(tmap->memory_count < MAX_BOUND_MEMORY, "tilemap_bind_memory: too many memory bindings");
+	assert_always(base != NULL && bytes_per_entry > 0, "tilemap_bind_memory: invalid parameters");
+
+	/* take a snapshot of the current contents */
+	binding = &tmap->memory[tmap->memory_count++];
+	binding->base = (const UINT8 *)base;
+	binding->stride = bytes_per_entry;
+	binding->bytes = tmap->max_memory_index * bytes_per_entry;
+	binding->shadow = alloc_array_or_die(UINT8, binding->bytes);
+	memcpy(binding->shadow, binding->base, binding->bytes);
+
+	/* everything needs to be drawn at least once from the new source */
+	tilemap_mark_all_tiles_dirty(tmap);
+}
+
+
+/*-------------------------------------------------
+    tilemap_bind_dependency - watch a value the
+    tile info callback depends on; a change marks
+    the whole tilemap dirty
+-------------------------------------------------*/
+
+void tilemap_bind_dependency(tilemap *tmap, const void *base, int bytes)
+{
+	tilemap_binding *binding;
+
+	assert_always(tmap->depend_count < MAX_BOUND_DEPENDENCIES, "tilemap_bind_dependency: too many dependencies");
+	assert_always(base != NULL && bytes > 0, "tilemap_bind_dependency: invalid parameters");
+
+	binding = &tmap->depend[tmap->depend_count++];
+	binding->base = (const UINT8 *)base;
+	binding->stride = bytes;
+	binding->bytes = bytes;
+	binding->shadow = alloc_array_or_die(UINT8, bytes);
+	memcpy(binding->shadow, binding->base, bytes);
+	tilemap_mark_all_tiles_dirty(tmap);
+}
+
+
 /***************************************************************************
     PEN-TO-LAYER MAPPING
 ***************************************************************************/
@@ -597,6 +887,8 @@ void tilemap_set_transmask(tilemap *tmap, int group, UINT32 fgmask, UINT32 bgmas
 void tilemap_set_scroll_rows(tilemap *tmap, UINT32 scroll_rows)
 {
 	assert(scroll_rows <= tmap->height);
+	if (tmap->scrollrows != scroll_rows)
+		tmap->drawseq++;
 	tmap->scrollrows = scroll_rows;
 }
 
@@ -610,6 +902,8 @@ void tilemap_set_scroll_rows(tilemap *tmap, UINT32 scroll_rows)
 void tilemap_set_scroll_cols(tilemap *tmap, UINT32 scroll_cols)
 {
 	assert(scroll_cols <= tmap->width);
+	if (tmap->scrollcols != scroll_cols)
+		tmap->drawseq++;
 	tmap->scrollcols = scroll_cols;
 }
 
@@ -622,6 +916,8 @@ void tilemap_set_scroll_cols(tilemap *tmap, UINT32 scroll_cols)
 
 void tilemap_set_scrolldx(tilemap *tmap, int dx, int dx_flipped)
 {
+	if (tmap->dx != dx || tmap->dx_flipped != dx_flipped)
+		tmap->drawseq++;
 	tmap->dx = dx;
 	tmap->dx_flipped = dx_flipped;
 }
@@ -635,6 +931,8 @@ void tilemap_set_scrolldx(tilemap *tmap, int dx, int dx_flipped)
 
 void tilemap_set_scrolldy(tilemap *tmap, int dy, int dy_flipped)
 {
+	if (tmap->dy != dy || tmap->dy_flipped != dy_flipped)
+		tmap->drawseq++;
 	tmap->dy = dy;
 	tmap->dy_flipped = dy_flipped;
 }
@@ -671,8 +969,11 @@ int tilemap_get_scrolldy(tilemap *tmap)
 
 void tilemap_set_scrollx(tilemap *tmap, int which, int value)
 {
-	if (which < tmap->scrollrows)
+	if (which < tmap->scrollrows && tmap->rowscroll[which] != value)
+	{
 		tmap->rowscroll[which] = value;
+		tmap->drawseq++;
+	}
 }
 
 
@@ -683,8 +984,11 @@ void tilemap_set_scrollx(tilemap *tmap, int which, int value)
 
 void tilemap_set_scrolly(tilemap *tmap, int which, int value)
 {
-	if (which < tmap->scrollcols)
+	if (which < tmap->scrollcols && tmap->colscroll[which] != value)
+	{
 		tmap->colscroll[which] = value;
+		tmap->drawseq++;
+	}
 }
 
 
@@ -760,6 +1064,37 @@ UINT8 *tilemap_get_tile_flags(tilemap *tmap)
 }
 
 
+/*-------------------------------------------------
+    tilemap_get_draw_seq - bring the tiles that a
+    draw of the visible area touches up to date
+    and return a value that changes whenever such
+    a draw could produce different pixels; tile
+    changes outside that area are ignored
+-------------------------------------------------*/
+
+UINT32 tilemap_get_draw_seq(tilemap *tmap, const rectangle *visarea)
+{
+	UINT32 width  = video_screen_get_width(tmap->machine->primary_screen);
+	UINT32 height = video_screen_get_height(tmap->machine->primary_screen);
+
+	/* pick up any changes to bound memory */
+	bindings_update(tmap);
+
+	/* if the whole map is dirty, mark it as such */
+	if (tmap->all_tiles_dirty || gfx_elements_changed(tmap))
+	{
+		memset(tmap->tileflags, TILE_FLAG_DIRTY, tmap->max_logical_index);
+		tmap->all_tiles_dirty = FALSE;
+		tmap->gfx_used = 0;
+	}
+
+	/* the watched area only moves with the scroll, which bumps the sequence itself */
+	visible_tiles(tmap, visarea, width, height, &tmap->seqcol, &tmap->seqcols, &tmap->seqrow, &tmap->seqrows);
+	pixmap_update_visible(tmap, visarea, width, height);
+	return tmap->drawseq;
+}
+
+
 
 /***************************************************************************
     TILEMAP RENDERING
@@ -773,9 +1108,7 @@ UINT8 *tilemap_get_tile_flags(tilemap *tmap)
 
 void tilemap_draw_primask(bitmap_t *dest, const rectangle *cliprect, tilemap *tmap, UINT32 flags, UINT8 priority, UINT8 priority_mask)
 {
-	UINT32 width, height;
 	blit_parameters blit;
-	int xpos, ypos;
 
 	/* skip if disabled */
 	if (!tmap->enable)
@@ -784,106 +1117,33 @@ void tilemap_draw_primask(bitmap_t *dest, const rectangle *cliprect, tilemap *tm
 profiler_mark_start(PROFILER_TILEMAP_DRAW);
 	/* configure the blit parameters based on the input parameters */
 	configure_blit_parameters(&blit, tmap, dest, cliprect, flags, priority, priority_mask);
+	tilemap_draw_blit(tmap, &blit);
+profiler_mark_end();
+}
 
-	/* if the whole map is dirty, mark it as such */
-	if (tmap->all_tiles_dirty || gfx_elements_changed(tmap))
-	{
-		memset(tmap->tileflags, TILE_FLAG_DIRTY, tmap->max_logical_index);
-		tmap->all_tiles_dirty = FALSE;
-		tmap->gfx_used = 0;
-	}
-
-	width  = video_screen_get_width(tmap->machine->primary_screen);
-	height = video_screen_get_height(tmap->machine->primary_screen);
-
-	/* XY scrolling playfield */
-	if (tmap->scrollrows == 1 && tmap->scrollcols == 1)
-	{
-		int scrollx = effective_rowscroll(tmap, 0, width);
-		int scrolly = effective_colscroll(tmap, 0, height);
-
-		/* iterate to handle wraparound */
-		for (ypos = scrolly - tmap->height; ypos <= blit.cliprect.max_y; ypos += tmap->height)
-			for (xpos = scrollx - tmap->width; xpos <= blit.cliprect.max_x; xpos += tmap->width)
-				tilemap_draw_instance(tmap, &blit, xpos, ypos);
-	}
-
-	/* scrolling rows + vertical scroll */
-	else if (tmap->scrollcols == 1)
-	{
-		const rectangle original_cliprect = blit.cliprect;
-		int rowheight = tmap->height / tmap->scrollrows;
-		int scrolly = effective_colscroll(tmap, 0, height);
-		int currow, nextrow;
-
-		/* iterate over Y to handle wraparound */
-		for (ypos = scrolly - tmap->height; ypos <= original_cliprect.max_y; ypos += tmap->height)
-		{
-			int const firstrow = MAX((original_cliprect.min_y - ypos) / rowheight, 0);
-			int const lastrow =  MIN((original_cliprect.max_y - ypos) / rowheight, tmap->scrollrows - 1);
-
-			/* iterate over rows in the tilemap */
-			for (currow = firstrow; currow <= lastrow; currow = nextrow)
-			{
-				int scrollx = effective_rowscroll(tmap, currow, width);
-
-				/* scan forward until we find a non-matching row */
-				for (nextrow = currow + 1; nextrow <= lastrow; nextrow++)
-					if (effective_rowscroll(tmap, nextrow, width) != scrollx)
-						break;
-
-				/* skip if disabled */
-				if (scrollx == TILE_LINE_DISABLED)
-					continue;
-
-				/* update the cliprect just for this set of rows */
-				blit.cliprect.min_y = currow * rowheight + ypos;
-				blit.cliprect.max_y = nextrow * rowheight - 1 + ypos;
-				sect_rect(&blit.cliprect, &original_cliprect);
-
-				/* iterate over X to handle wraparound */
-				for (xpos = scrollx - tmap->width; xpos <= original_cliprect.max_x; xpos += tmap->width)
-					tilemap_draw_instance(tmap, &blit, xpos, ypos);
-			}
-		}
-	}
-
-	/* scrolling columns + horizontal scroll */
-	else if (tmap->scrollrows == 1)
-	{
-		const rectangle original_cliprect = blit.cliprect;
-		int colwidth = tmap->width / tmap->scrollcols;
-		int scrollx = effective_rowscroll(tmap, 0, width);
-		int curcol, nextcol;
 
-		/* iterate over columns in the tilemap */
-		for (curcol = 0; curcol < tmap->scrollcols; curcol = nextcol)
-		{
-			int scrolly	= effective_colscroll(tmap, curcol, height);
+/*-------------------------------------------------
+    tilemap_draw_coverage - draw a tilemap to the
+    destination with clipping, setting pixels of
+    an 8bpp coverage bitmap to 1 wherever it
+    draws instead of touching the priority bitmap
+-------------------------------------------------*/
 
-			/* scan forward until we find a non-matching column */
-			for (nextcol = curcol + 1; nextcol < tmap->scrollcols; nextcol++)
-				if (effective_colscroll(tmap, nextcol, height) != scrolly)
-					break;
+void tilemap_draw_coverage(bitmap_t *dest, bitmap_t *coverage, const rectangle *cliprect, tilemap *tmap, UINT32 flags)
+{
+	blit_parameters blit;
 
- 			/* skip if disabled */
-			if (scrolly == TILE_LINE_DISABLED)
-				continue;
+	assert(coverage != NULL && coverage->bpp == 8);
 
-			/* iterate over X to handle wraparound */
-			for (xpos = scrollx - tmap->width; xpos <= original_cliprect.max_x; xpos += tmap->width)
-			{
-				/* update the cliprect just for this set of columns */
-				blit.cliprect.min_x = curcol * colwidth + xpos;
-				blit.cliprect.max_x = nextcol * colwidth - 1 + xpos;
-				sect_rect(&blit.cliprect, &original_cliprect);
+	/* skip if disabled */
+	if (!tmap->enable)
+		return;
 
-				/* iterate over Y to handle wraparound */
-				for (ypos = scrolly - tmap->height; ypos <= original_cliprect.max_y; ypos += tmap->height)
-					tilemap_draw_instance(tmap, &blit, xpos, ypos);
-			}
-		}
-	}
+profiler_mark_start(PROFILER_TILEMAP_DRAW);
+	/* a priority of 1 with a mask of 0 leaves exactly 1 in every covered pixel */
+	configure_blit_parameters(&blit, tmap, dest, cliprect, flags, 1, 0);
+	blit.priority = coverage;
+	tilemap_draw_blit(tmap, &blit);
 profiler_mark_end();
 }
 
@@ -985,6 +1245,9 @@ void tilemap_draw_by_index(running_machine *machine, bitmap_t *dest, int number,
 	scrollx = tmap->width  - scrollx % tmap->width;
 	scrolly = tmap->height - scrolly % tmap->height;
 
+	/* pick up any changes to bound memory */
+	bindings_update(tmap);
+
 	/* if the whole map is dirty, mark it as such */
 	if (tmap->all_tiles_dirty || gfx_elements_changed(tmap))
 	{
@@ -1085,6 +1348,11 @@ static void tilemap_exit(running_machine *machine)
 		tilemap_data->list = next;
 	}
 	tilemap_data->tailptr = &tilemap_data->list;
+
+	/* free the work queue */
+	if (tilemap_data->work_queue != NULL)
+		osd_work_queue_free(tilemap_data->work_queue);
+	tilemap_data->work_queue = NULL;
 }
 
 
@@ -1098,6 +1366,9 @@ static STATE_POSTLOAD( tilemap_postload )
 	/* recompute the mappings for this tilemap */
 	tilemap *tmap = (tilemap *)param;
 	mappings_update(tmap);
+
+	/* scroll and enable state came back without going through the setters */
+	tmap->drawseq++;
 }
 
 
@@ -1108,6 +1379,7 @@ static STATE_POSTLOAD( tilemap_postload )
 static void tilemap_dispose(tilemap *tmap)
 {
 	tilemap **tmapptr;
+	int i;
 
 	/* walk the list of tilemaps; when we find ourself, remove it */
 	for (tmapptr = &tmap->machine->tilemap_data->list; *tmapptr != NULL; tmapptr = &(*tmapptr)->next)
@@ -1118,6 +1390,12 @@ static void tilemap_dispose(tilemap *tmap)
 		}
 
 	/* free allocated memory */
+	for (i = 0; i < tmap->memory_count; i++)
+		free(tmap->memory[i].shadow);
+	for (i = 0; i < tmap->depend_count; i++)
+		free(tmap->depend[i].shadow);
+	if (tmap->pending != NULL)
+		free(tmap->pending);
 	free(tmap->pen_to_flags);
 	free(tmap->tileflags);
 	bitmap_free(tmap->flagsmap);
@@ -1206,6 +1484,56 @@ static void mappings_update(tilemap *tmap)
 
 
 
+/***************************************************************************
+    AUTOMATIC DIRTY TRACKING
+***************************************************************************/
+
+/*-------------------------------------------------
+    bindings_update - compare the bound memory
+    against its shadow copy and mark the tiles
+    whose entries changed dirty
+-------------------------------------------------*/
+
+static void bindings_update(tilemap *tmap)
+{
+	int bindnum;
+
+	/* any change to a dependency dirties everything */
+	for (bindnum = 0; bindnum < tmap->depend_count; bindnum++)
+	{
+		tilemap_binding *binding = &tmap->depend[bindnum];
+		if (memcmp(binding->shadow, binding->base, binding->bytes) != 0)
+		{
+			memcpy(binding->shadow, binding->base, binding->bytes);
+			tilemap_mark_all_tiles_dirty(tmap);
+		}
+	}
+
+	/* scan the tile memory in chunks, only looking at single entries when a chunk differs */
+	for (bindnum = 0; bindnum < tmap->memory_count; bindnum++)
+	{
+		tilemap_binding *binding = &tmap->memory[bindnum];
+		UINT32 chunkbytes = MAX(BINDING_CHUNK_BYTES / binding->stride, 1) * binding->stride;
+		UINT32 offset;
+
+		for (offset = 0; offset < binding->bytes; offset += chunkbytes)
+		{
+			UINT32 length = MIN(chunkbytes, binding->bytes - offset);
+			UINT32 entry;
+
+			if (memcmp(binding->shadow + offset, binding->base + offset, length) == 0)
+				continue;
+
+			for (entry = offset; entry < offset + length; entry += binding->stride)
+				if (memcmp(binding->shadow + entry, binding->base + entry, binding->stride) != 0)
+					tilemap_mark_tile_dirty(tmap, entry / binding->stride);
+			memcpy(binding->shadow + offset, binding->base + offset, length);
+		}
+	}
+}
+
+
+
 /***************************************************************************
     TILE RENDERING
 ***************************************************************************/
@@ -1220,6 +1548,9 @@ static void pixmap_update(tilemap *tmap, const rectangle *cliprect)
 	int mincol, maxcol, minrow, maxrow;
 	int row, col;
 
+	/* pick up any changes to bound memory */
+	bindings_update(tmap);
+
 	/* if the graphics changed, we need to mark everything dirty */
  	if (gfx_elements_changed(tmap))
 		tilemap_mark_all_tiles_dirty(tmap);
@@ -1261,9 +1592,19 @@ profiler_mark_start(PROFILER_TILEMAP_DRAW);
 		/* iterate over colums */
 		for (col = mincol; col <= maxcol; col++)
 			if (tmap->tileflags[logindex + col] == TILE_FLAG_DIRTY)
-				tile_update(tmap, logindex + col, col, row);
+			{
+				/* when rendering in parallel, just collect the tile info for now */
+				if (tmap->pending != NULL)
+					tile_fetch(tmap, logindex + col, col, row, &tmap->pending[tmap->pending_count++]);
+				else
+					tile_update(tmap, logindex + col, col, row);
+			}
 	}
 
+	/* draw any tiles we collected */
+	if (tmap->pending != NULL)
+		tile_flush_pending(tmap);
+
 	/* mark it all clean */
 	if (mincol == 0 && minrow == 0 && maxcol == tmap->cols - 1 && maxcol == tmap->rows - 1)
 		tmap->all_tiles_clean = TRUE;
@@ -1273,32 +1614,132 @@ profiler_mark_end();
 
 
 /*-------------------------------------------------
-    tile_update - update a single dirty tile
+    pixmap_update_visible - update the dirty
+    tiles that a draw of the given cliprect will
+    touch, drawing them in parallel if we can
 -------------------------------------------------*/
 
-static void tile_update(tilemap *tmap, tilemap_logical_index logindex, UINT32 col, UINT32 row)
+static void pixmap_update_visible(tilemap *tmap, const rectangle *cliprect, UINT32 width, UINT32 height)
 {
-	UINT32 x0 = tmap->tilewidth * col;
-	UINT32 y0 = tmap->tileheight * row;
-	tilemap_memory_index memindex;
-	UINT32 flags;
+	UINT32 firstcol, numcols, firstrow, numrows;
+	UINT32 row, col;
 
 profiler_mark_start(PROFILER_TILEMAP_UPDATE);
 
+	visible_tiles(tmap, cliprect, width, height, &firstcol, &numcols, &firstrow, &numrows);
+
+	/* collect the info for each dirty tile, wrapping around the edges */
+	for (row = 0; row < numrows; row++)
+	{
+		UINT32 currow = (firstrow + row) % tmap->rows;
+		tilemap_logical_index logindex = currow * tmap->cols;
+
+		for (col = 0; col < numcols; col++)
+		{
+			UINT32 curcol = (firstcol + col) % tmap->cols;
+			if (tmap->tileflags[logindex + curcol] == TILE_FLAG_DIRTY)
+			{
+				if (tmap->pending != NULL)
+					tile_fetch(tmap, logindex + curcol, curcol, currow, &tmap->pending[tmap->pending_count++]);
+				else
+					tile_update(tmap, logindex + curcol, curcol, currow);
+			}
+		}
+	}
+
+	/* then draw them */
+	if (tmap->pending != NULL)
+		tile_flush_pending(tmap);
+
+profiler_mark_end();
+}
+
+
+/*-------------------------------------------------
+    visible_tiles - compute the range of tile
+    columns and rows that a draw of the given
+    cliprect touches; both ranges may wrap
+-------------------------------------------------*/
+
+static void visible_tiles(tilemap *tmap, const rectangle *cliprect, UINT32 width, UINT32 height, UINT32 *firstcol, UINT32 *numcols, UINT32 *firstrow, UINT32 *numrows)
+{
+	INT32 srcx = 0, srcy = 0;
+	UINT32 spanx = tmap->width, spany = tmap->height;
+
+	/* a single horizontal scroll limits the columns we need */
+	if (tmap->scrollrows == 1)
+	{
+		srcx = (cliprect->min_x - effective_rowscroll(tmap, 0, width)) % (INT32)tmap->width;
+		if (srcx < 0)
+			srcx += tmap->width;
+		spanx = cliprect->max_x + 1 - cliprect->min_x;
+	}
+
+	/* a single vertical scroll limits the rows we need */
+	if (tmap->scrollcols == 1)
+	{
+		srcy = (cliprect->min_y - effective_colscroll(tmap, 0, height)) % (INT32)tmap->height;
+		if (srcy < 0)
+			srcy += tmap->height;
+		spany = cliprect->max_y + 1 - cliprect->min_y;
+	}
+
+	/* convert to tiles, rounding outward */
+	*firstcol = srcx / tmap->tilewidth;
+	*numcols = MIN((srcx % tmap->tilewidth + spanx + tmap->tilewidth - 1) / tmap->tilewidth, tmap->cols);
+	*firstrow = srcy / tmap->tileheight;
+	*numrows = MIN((srcy % tmap->tileheight + spany + tmap->tileheight - 1) / tmap->tileheight, tmap->rows);
+}
+
+
+/*-------------------------------------------------
+    tile_update - update a single dirty tile
+-------------------------------------------------*/
+
+static void tile_update(tilemap *tmap, tilemap_logical_index logindex, UINT32 col, UINT32 row)
+{
+	tile_pending tile;
+
+profiler_mark_start(PROFILER_TILEMAP_UPDATE);
+
+	/* fetch the tile info and draw it */
+	tile_fetch(tmap, logindex, col, row, &tile);
+	tmap->tileflags[logindex] = tile_render(tmap, &tile);
+	if (tile_is_watched(tmap, logindex))
+		tmap->drawseq++;
+
+profiler_mark_end();
+}
+
+
+/*-------------------------------------------------
+    tile_fetch - call the get info callback for
+    a single dirty tile and record what is needed
+    to draw it; this calls into the driver so it
+    must happen on the main thread
+-------------------------------------------------*/
+
+static void tile_fetch(tilemap *tmap, tilemap_logical_index logindex, UINT32 col, UINT32 row, tile_pending *tile)
+{
+	tilemap_memory_index memindex;
+
 	/* call the get info callback for the associated memory index */
 	memindex = tmap->logical_to_memory[logindex];
 	(*tmap->tile_get_info)(tmap->machine, &tmap->tileinfo, memindex, tmap->user_data);
 
-	/* apply the global tilemap flip to the returned flip flags */
-	flags = tmap->tileinfo.flags ^ (tmap->attributes & 0x03);
-
-	/* draw the tile, using either direct or transparent */
-	tmap->tileflags[logindex] = tile_draw(tmap, tmap->tileinfo.pen_data + tmap->pen_data_offset, x0, y0,
-		tmap->tileinfo.palette_base, tmap->tileinfo.category, tmap->tileinfo.group, flags, tmap->tileinfo.pen_mask);
+	/* record everything we need to draw the tile */
+	tile->logindex = logindex;
+	tile->x0 = tmap->tilewidth * col;
+	tile->y0 = tmap->tileheight * row;
+	tile->pen_data = tmap->tileinfo.pen_data + tmap->pen_data_offset;
+	tile->mask_data = tmap->tileinfo.mask_data;
+	tile->palette_base = tmap->tileinfo.palette_base;
+	tile->category = tmap->tileinfo.category;
+	tile->group = tmap->tileinfo.group;
+	tile->pen_mask = tmap->tileinfo.pen_mask;
 
-	/* if mask data is specified, apply it */
-	if ((flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && tmap->tileinfo.mask_data != NULL)
-		tmap->tileflags[logindex] = tile_apply_bitmask(tmap, tmap->tileinfo.mask_data, x0, y0, tmap->tileinfo.category, flags);
+	/* apply the global tilemap flip to the returned flip flags */
+	tile->flags = tmap->tileinfo.flags ^ (tmap->attributes & 0x03);
 
 	/* track which gfx have been used for this tilemap */
 	if (tmap->tileinfo.gfxnum != 0xff && (tmap->gfx_used & (1 << tmap->tileinfo.gfxnum)) == 0)
@@ -1306,8 +1747,93 @@ profiler_mark_start(PROFILER_TILEMAP_UPDATE);
 		tmap->gfx_used |= 1 << tmap->tileinfo.gfxnum;
 		tmap->gfx_dirtyseq[tmap->tileinfo.gfxnum] = tmap->machine->gfx[tmap->tileinfo.gfxnum]->dirtyseq;
 	}
+}
 
-profiler_mark_end();
+
+/*-------------------------------------------------
+    tile_render - draw a fetched tile into the
+    pixmap and return its tile flags; this only
+    touches the tile's own pixels so it is safe
+    to run on any thread
+-------------------------------------------------*/
+
+static UINT8 tile_render(tilemap *tmap, const tile_pending *tile)
+{
+	UINT8 tileflags;
+
+	/* draw the tile, using either direct or transparent */
+	tileflags = tile_draw(tmap, tile->pen_data, tile->x0, tile->y0, tile->palette_base, tile->category, tile->group, tile->flags, tile->pen_mask);
+
+	/* if mask data is specified, apply it */
+	if ((tile->flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && tile->mask_data != NULL)
+		tileflags = tile_apply_bitmask(tmap, tile->mask_data, tile->x0, tile->y0, tile->category, tile->flags);
+
+	return tileflags;
+}
+
+
+/*-------------------------------------------------
+    tile_flush_pending - draw all the fetched
+    tiles, splitting them into batches across
+    the work queue if there are enough of them
+-------------------------------------------------*/
+
+static void tile_flush_pending(tilemap *tmap)
+{
+	UINT32 count = tmap->pending_count;
+	UINT32 tilenum;
+
+	/* only tiles in the watched area change what a draw of it produces */
+	tmap->pending_count = 0;
+	for (tilenum = 0; tilenum < count; tilenum++)
+		if (tile_is_watched(tmap, tmap->pending[tilenum].logindex))
+		{
+			tmap->drawseq++;
+			break;
+		}
+
+	/* small updates are cheaper to just do here */
+	if (count < 2 * MIN_BATCH_TILES)
+	{
+		for (tilenum = 0; tilenum < count; tilenum++)
+			tmap->tileflags[tmap->pending[tilenum].logindex] = tile_render(tmap, &tmap->pending[tilenum]);
+	}
+
+	/* otherwise, split into batches */
+	else
+	{
+		osd_work_queue *queue = tmap->machine->tilemap_data->work_queue;
+		UINT32 numbatches = MIN(count / MIN_BATCH_TILES, MAX_BATCHES);
+		tile_batch batch[MAX_BATCHES];
+		UINT32 batchnum;
+
+		for (batchnum = 0; batchnum < numbatches; batchnum++)
+		{
+			batch[batchnum].tmap = tmap;
+			batch[batchnum].start = count * batchnum / numbatches;
+			batch[batchnum].count = count * (batchnum + 1) / numbatches - batch[batchnum].start;
+		}
+
+		osd_work_item_queue_multiple(queue, tile_render_batch, numbatches, batch, sizeof(batch[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(queue, osd_ticks_per_second() * 10);
+	}
+}
+
+
+/*-------------------------------------------------
+    tile_render_batch - work item callback to
+    draw a batch of fetched tiles
+-------------------------------------------------*/
+
+static void *tile_render_batch(void *param, int threadid)
+{
+	tile_batch *batch = (tile_batch *)param;
+	tilemap *tmap = batch->tmap;
+	UINT32 tilenum;
+
+	for (tilenum = batch->start; tilenum < batch->start + batch->count; tilenum++)
+		tmap->tileflags[tmap->pending[tilenum].logindex] = tile_render(tmap, &tmap->pending[tilenum]);
+	return NULL;
 }
 
 
@@ -1481,8 +2007,9 @@ static void configure_blit_parameters(blit_parameters *blit, tilemap *tmap, bitm
 	/* start with nothing */
 	memset(blit, 0, sizeof(*blit));
 
-	/* set the target bitmap */
+	/* set the target bitmap and the priority bitmap */
 	blit->bitmap = dest;
+	blit->priority = tmap->machine->priority_bitmap;
 
 	/* if we have a cliprect, copy */
 	if (cliprect != NULL)
@@ -1561,6 +2088,179 @@ static void configure_blit_parameters(blit_parameters *blit, tilemap *tmap, bitm
 }
 
 
+/*-------------------------------------------------
+    tilemap_draw_blit - draw a tilemap according
+    to a set of configured blit parameters
+-------------------------------------------------*/
+
+static void tilemap_draw_blit(tilemap *tmap, blit_parameters *blit)
+{
+	osd_work_queue *queue = tmap->machine->tilemap_data->work_queue;
+	UINT32 width, height;
+	int numbands;
+
+	/* pick up any changes to bound memory */
+	bindings_update(tmap);
+
+	/* if the whole map is dirty, mark it as such */
+	if (tmap->all_tiles_dirty || gfx_elements_changed(tmap))
+	{
+		memset(tmap->tileflags, TILE_FLAG_DIRTY, tmap->max_logical_index);
+		tmap->all_tiles_dirty = FALSE;
+		tmap->gfx_used = 0;
+	}
+
+	width  = video_screen_get_width(tmap->machine->primary_screen);
+	height = video_screen_get_height(tmap->machine->primary_screen);
+
+	/* figure out how many bands we can split into; row and column scroll together is never drawn */
+	numbands = 1;
+	if (queue != NULL && (tmap->scrollrows == 1 || tmap->scrollcols == 1))
+		numbands = MIN((blit->cliprect.max_y + 1 - blit->cliprect.min_y) / MIN_BAND_HEIGHT, MAX_BANDS);
+
+	/* single band: draw directly */
+	if (numbands <= 1)
+		tilemap_draw_clipped(tmap, blit, width, height);
+
+	/* multiple bands: fetch all the visible dirty tiles here, then render the bands in parallel */
+	else
+	{
+		tilemap_band band[MAX_BANDS];
+		int totalheight = blit->cliprect.max_y + 1 - blit->cliprect.min_y;
+		int bandnum;
+
+		pixmap_update_visible(tmap, &blit->cliprect, width, height);
+
+		for (bandnum = 0; bandnum < numbands; bandnum++)
+		{
+			band[bandnum].tmap = tmap;
+			band[bandnum].blit = *blit;
+			band[bandnum].blit.cliprect.min_y = blit->cliprect.min_y + totalheight * bandnum / numbands;
+			band[bandnum].blit.cliprect.max_y = blit->cliprect.min_y + totalheight * (bandnum + 1) / numbands - 1;
+			band[bandnum].screen_width = width;
+			band[bandnum].screen_height = height;
+		}
+
+		osd_work_item_queue_multiple(queue, tilemap_draw_band, numbands, band, sizeof(band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(queue, osd_ticks_per_second() * 10);
+	}
+}
+
+
+/*-------------------------------------------------
+    tilemap_draw_clipped - draw a tilemap within
+    the blit cliprect, handling row and column
+    scroll and wraparound
+-------------------------------------------------*/
+
+static void tilemap_draw_clipped(tilemap *tmap, blit_parameters *blit, UINT32 width, UINT32 height)
+{
+	int xpos, ypos;
+
+	/* XY scrolling playfield */
+	if (tmap->scrollrows == 1 && tmap->scrollcols == 1)
+	{
+		int scrollx = effective_rowscroll(tmap, 0, width);
+		int scrolly = effective_colscroll(tmap, 0, height);
+
+		/* iterate to handle wraparound */
+		for (ypos = scrolly - tmap->height; ypos <= blit->cliprect.max_y; ypos += tmap->height)
+			for (xpos = scrollx - tmap->width; xpos <= blit->cliprect.max_x; xpos += tmap->width)
+				tilemap_draw_instance(tmap, blit, xpos, ypos);
+	}
+
+	/* scrolling rows + vertical scroll */
+	else if (tmap->scrollcols == 1)
+	{
+		const rectangle original_cliprect = blit->cliprect;
+		int rowheight = tmap->height / tmap->scrollrows;
+		int scrolly = effective_colscroll(tmap, 0, height);
+		int currow, nextrow;
+
+		/* iterate over Y to handle wraparound */
+		for (ypos = scrolly - tmap->height; ypos <= original_cliprect.max_y; ypos += tmap->height)
+		{
+			int const firstrow = MAX((original_cliprect.min_y - ypos) / rowheight, 0);
+			int const lastrow =  MIN((original_cliprect.max_y - ypos) / rowheight, tmap->scrollrows - 1);
+
+			/* iterate over rows in the tilemap */
+			for (currow = firstrow; currow <= lastrow; currow = nextrow)
+			{
+				int scrollx = effective_rowscroll(tmap, currow, width);
+
+				/* scan forward until we find a non-matching row */
+				for (nextrow = currow + 1; nextrow <= lastrow; nextrow++)
+					if (effective_rowscroll(tmap, nextrow, width) != scrollx)
+						break;
+
+				/* skip if disabled */
+				if (scrollx == TILE_LINE_DISABLED)
+					continue;
+
+				/* update the cliprect just for this set of rows */
+				blit->cliprect.min_y = currow * rowheight + ypos;
+				blit->cliprect.max_y = nextrow * rowheight - 1 + ypos;
+				sect_rect(&blit->cliprect, &original_cliprect);
+
+				/* iterate over X to handle wraparound */
+				for (xpos = scrollx - tmap->width; xpos <= original_cliprect.max_x; xpos += tmap->width)
+					tilemap_draw_instance(tmap, blit, xpos, ypos);
+			}
+		}
+	}
+
+	/* scrolling columns + horizontal scroll */
+	else if (tmap->scrollrows == 1)
+	{
+		const rectangle original_cliprect = blit->cliprect;
+		int colwidth = tmap->width / tmap->scrollcols;
+		int scrollx = effective_rowscroll(tmap, 0, width);
+		int curcol, nextcol;
+
+		/* iterate over columns in the tilemap */
+		for (curcol = 0; curcol < tmap->scrollcols; curcol = nextcol)
+		{
+			int scrolly	= effective_colscroll(tmap, curcol, height);
+
+			/* scan forward until we find a non-matching column */
+			for (nextcol = curcol + 1; nextcol < tmap->scrollcols; nextcol++)
+				if (effective_colscroll(tmap, nextcol, height) != scrolly)
+					break;
+
+ 			/* skip if disabled */
+			if (scrolly == TILE_LINE_DISABLED)
+				continue;
+
+			/* iterate over X to handle wraparound */
+			for (xpos = scrollx - tmap->width; xpos <= original_cliprect.max_x; xpos += tmap->width)
+			{
+				/* update the cliprect just for this set of columns */
+				blit->cliprect.min_x = curcol * colwidth + xpos;
+				blit->cliprect.max_x = nextcol * colwidth - 1 + xpos;
+				sect_rect(&blit->cliprect, &original_cliprect);
+
+				/* iterate over Y to handle wraparound */
+				for (ypos = scrolly - tmap->height; ypos <= original_cliprect.max_y; ypos += tmap->height)
+					tilemap_draw_instance(tmap, blit, xpos, ypos);
+			}
+		}
+	}
+}
+
+
+/*-------------------------------------------------
+    tilemap_draw_band - work item callback to
+    draw one horizontal band of a tilemap
+-------------------------------------------------*/
+
+static void *tilemap_draw_band(void *param, int threadid)
+{
+	tilemap_band *band = (tilemap_band *)param;
+	tilemap_draw_clipped(band->tmap, &band->blit, band->screen_width, band->screen_height);
+	return NULL;
+}
+
+
 /*-------------------------------------------------
     tilemap_draw_instance - draw a single
     instance of the tilemap to the internal
@@ -1569,7 +2269,7 @@ static void configure_blit_parameters(blit_parameters *blit, tilemap *tmap, bitm
 
 static void tilemap_draw_instance(tilemap *tmap, const blit_parameters *blit, int xpos, int ypos)
 {
-	bitmap_t *priority_bitmap = tmap->machine->priority_bitmap;
+	bitmap_t *priority_bitmap = blit->priority;
 	bitmap_t *dest = blit->bitmap;
 	const UINT16 *source_baseaddr;
 	const UINT8 *mask_baseaddr;
@@ -1934,14 +2634,9 @@ static void tilemap_draw_roz_core(tilemap *tmap, const blit_parameters *blit,
 
 static void scanline_draw_opaque_null(void *dest, const UINT16 *source, int count, const pen_t *pens, UINT8 *pri, UINT32 pcode, UINT8 alpha)
 {
-	int i;
-
 	/* skip entirely if not changing priority */
 	if (pcode != 0xff00)
-	{
-		for (i = 0; i < count; i++)
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-	}
+		scanline_priority_opaque(pri, count, pcode);
 }
 
 
@@ -1952,15 +2647,9 @@ static void scanline_draw_opaque_null(void *dest, const UINT16 *source, int coun
 
 static void scanline_draw_masked_null(void *dest, const UINT16 *source, const UINT8 *maskptr, int mask, int value, int count, const pen_t *pens, UINT8 *pri, UINT32 pcode, UINT8 alpha)
 {
-	int i;
-
 	/* skip entirely if not changing priority */
 	if (pcode != 0xff00)
-	{
-		for (i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-	}
+		scanline_priority_masked(pri, maskptr, mask, value, count, pcode);
 }
 
 
@@ -1974,7 +2663,6 @@ static void scanline_draw_opaque_ind16(void *_dest, const UINT16 *source, int co
 {
 	UINT16 *dest = (UINT16 *)_dest;
 	int pal = pcode >> 16;
-	int i;
 
 	/* special case for no palette offset */
 	if (pal == 0)
@@ -1983,28 +2671,19 @@ static void scanline_draw_opaque_ind16(void *_dest, const UINT16 *source, int co
 
 		/* priority if necessary */
 		if (pcode != 0xff00)
-		{
-			for (i = 0; i < count; i++)
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
+			scanline_priority_opaque(pri, count, pcode);
 	}
 
 	/* priority case */
 	else if ((pcode & 0xffff) != 0xff00)
 	{
-		for (i = 0; i < count; i++)
-		{
-			dest[i] = source[i] + pal;
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
+		scanline_copy_ind16(dest, source, count, pal);
+		scanline_priority_opaque(pri, count, pcode);
 	}
 
 	/* no priority case */
 	else
-	{
-		for (i = 0; i < count; i++)
-			dest[i] = source[i] + pal;
-	}
+		scanline_copy_ind16(dest, source, count, pal);
 }
 
 
@@ -2017,26 +2696,17 @@ static void scanline_draw_masked_ind16(void *_dest, const UINT16 *source, const
 {
 	UINT16 *dest = (UINT16 *)_dest;
 	int pal = pcode >> 16;
-	int i;
 
 	/* priority case */
 	if ((pcode & 0xffff) != 0xff00)
 	{
-		for (i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-			{
-				dest[i] = source[i] + pal;
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
+		scanline_copy_masked_ind16(dest, source, maskptr, mask, value, count, pal);
+		scanline_priority_masked(pri, maskptr, mask, value, count, pcode);
 	}
 
 	/* no priority case */
 	else
-	{
-		for (i = 0; i < count; i++)
-			if ((maskptr[i] & mask) == value)
-				dest[i] = source[i] + pal;
-	}
+		scanline_copy_masked_ind16(dest, source, maskptr, mask, value, count, pal);
 }
 
 
@@ -2056,10 +2726,8 @@ static void scanline_draw_opaque_rgb16(void *_dest, const UINT16 *source, int co
 	if ((pcode & 0xffff) != 0xff00)
 	{
 		for (i = 0; i < count; i++)
-		{
 			dest[i] = clut[source[i]];
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
+		scanline_priority_opaque(pri, count, pcode);
 	}
 
 	/* no priority case */
@@ -2087,10 +2755,8 @@ static void scanline_draw_masked_rgb16(void *_dest, const UINT16 *source, const
 	{
 		for (i = 0; i < count; i++)
 			if ((maskptr[i] & mask) == value)
-			{
 				dest[i] = clut[source[i]];
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
+		scanline_priority_masked(pri, maskptr, mask, value, count, pcode);
 	}
 
 	/* no priority case */
@@ -2118,10 +2784,8 @@ static void scanline_draw_opaque_rgb16_alpha(void *_dest, const UINT16 *source,
 	if ((pcode & 0xffff) != 0xff00)
 	{
 		for (i = 0; i < count; i++)
-		{
 			dest[i] = alpha_blend_r16(dest[i], clut[source[i]], alpha);
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
+		scanline_priority_opaque(pri, count, pcode);
 	}
 
 	/* no priority case */
@@ -2150,10 +2814,8 @@ static void scanline_draw_masked_rgb16_alpha(void *_dest, const UINT16 *source,
 	{
 		for (i = 0; i < count; i++)
 			if ((maskptr[i] & mask) == value)
-			{
 				dest[i] = alpha_blend_r16(dest[i], clut[source[i]], alpha);
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
+		scanline_priority_masked(pri, maskptr, mask, value, count, pcode);
 	}
 
 	/* no priority case */
@@ -2181,10 +2843,8 @@ static void scanline_draw_opaque_rgb32(void *_dest, const UINT16 *source, int co
 	if ((pcode & 0xffff) != 0xff00)
 	{
 		for (i = 0; i < count; i++)
-		{
 			dest[i] = clut[source[i]];
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
+		scanline_priority_opaque(pri, count, pcode);
 	}
 
 	/* no priority case */
@@ -2212,10 +2872,8 @@ static void scanline_draw_masked_rgb32(void *_dest, const UINT16 *source, const
 	{
 		for (i = 0; i < count; i++)
 			if ((maskptr[i] & mask) == value)
-			{
 				dest[i] = clut[source[i]];
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
+		scanline_priority_masked(pri, maskptr, mask, value, count, pcode);
 	}
 
 	/* no priority case */
@@ -2243,10 +2901,8 @@ static void scanline_draw_opaque_rgb32_alpha(void *_dest, const UINT16 *source,
 	if ((pcode & 0xffff) != 0xff00)
 	{
 		for (i = 0; i < count; i++)
-		{
 			dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-			pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-		}
+		scanline_priority_opaque(pri, count, pcode);
 	}
 
 	/* no priority case */
@@ -2275,10 +2931,8 @@ static void scanline_draw_masked_rgb32_alpha(void *_dest, const UINT16 *source,
 	{
 		for (i = 0; i < count; i++)
 			if ((maskptr[i] & mask) == value)
-			{
 				dest[i] = alpha_blend_r32(dest[i], clut[source[i]], alpha);
-				pri[i] = (pri[i] & (pcode >> 8)) | pcode;
-			}
+		scanline_priority_masked(pri, maskptr, mask, value, count, pcode);
 	}
 
 	/* no priority case */
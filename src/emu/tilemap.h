@@ -136,6 +136,12 @@
         re-rendered with the new data the next time the tilemap is drawn.
         Use tilemap_mark_tile_dirty() and pass in the memory index.
 
+        Alternatively, if the tile memory is plain RAM with a fixed
+        number of bytes per memory index, bind it once with
+        tilemap_bind_memory() (once per array, e.g. for separate code
+        and attribute RAM). Changed entries are then found and marked
+        dirty automatically each time the tilemap is drawn.
+
     4. In your handlers for scrolling, update the scroll values for the
         tilemap via tilemap_set_scrollx() and tilemap_set_scrolly().
 
@@ -143,7 +149,9 @@
         any global state that is used by the tile_get_info callback but
         which is not reported via other calls to the tilemap code), you
         should invalidate the entire tilemap. You can do this by calling
-        tilemap_mark_all_tiles_dirty().
+        tilemap_mark_all_tiles_dirty(), or by binding the state with
+        tilemap_bind_dependency() so that only real changes invalidate
+        the tilemap.
 
     6. In your VIDEO_UPDATE callback, render the tiles by calling
         tilemap_draw() or tilemap_draw_roz(). If you need to do custom
@@ -453,6 +461,16 @@ void tilemap_mark_all_tiles_dirty_all(running_machine *machine);
 
 
 
+/* ----- automatic dirty tracking ----- */
+
+/* watch a block of RAM holding bytes_per_entry bytes per memory index; tiles whose entries change are marked dirty at draw time */
+void tilemap_bind_memory(tilemap *tmap, const void *base, int bytes_per_entry);
+
+/* watch a value the tile info depends on (bank, color select, ...); if it changes, all tiles are marked dirty */
+void tilemap_bind_dependency(tilemap *tmap, const void *base, int bytes);
+
+
+
 /* ----- pen-to-layer mapping ----- */
 
 /* specify the mapping of one or more pens (where (<pen> & mask == pen) to a layer */
@@ -503,6 +521,9 @@ bitmap_t *tilemap_get_flagsmap(tilemap *tmap);
 /* return a pointer to the (updated) internal per-tile flags for a tilemap */
 UINT8 *tilemap_get_tile_flags(tilemap *tmap);
 
+/* update the tiles visible in visarea and return a value that changes whenever drawing visarea could produce different pixels */
+UINT32 tilemap_get_draw_seq(tilemap *tmap, const rectangle *visarea);
+
 
 
 /* ----- tilemap rendering ----- */
@@ -510,6 +531,9 @@ UINT8 *tilemap_get_tile_flags(tilemap *tmap);
 /* draw a tilemap to the destination with clipping; pixels apply priority/priority_mask to the priority bitmap */
 void tilemap_draw_primask(bitmap_t *dest, const rectangle *cliprect, tilemap *tmap, UINT32 flags, UINT8 priority, UINT8 priority_mask);
 
+/* draw a tilemap to the destination with clipping; covered pixels are set to 1 in an 8bpp coverage bitmap */
+void tilemap_draw_coverage(bitmap_t *dest, bitmap_t *coverage, const rectangle *cliprect, tilemap *tmap, UINT32 flags);
+
 /* draw a tilemap to the destination with clipping and arbitrary rotate/zoom; */
 /* pixels apply priority/priority_mask to the priority bitmap */
 void tilemap_draw_roz_primask(bitmap_t *dest, const rectangle *cliprect, tilemap *tmap,
@@ -44,6 +44,8 @@
 #define MAX_VBLANK_CALLBACKS		(10)
 #define DEFAULT_FRAME_RATE			60
 #define DEFAULT_FRAME_PERIOD		ATTOTIME_IN_HZ(DEFAULT_FRAME_RATE)
+#define MAX_PARTIAL_STATE			(4)
+#define MAX_PARTIAL_SEGMENTS		(256)
 
 
 
@@ -51,6 +53,16 @@
     TYPE DEFINITIONS
 ***************************************************************************/
 
+/* a block of driver memory that a screen's VIDEO_UPDATE depends on */
+typedef struct _partial_state partial_state;
+struct _partial_state
+{
+	void *					base;					/* pointer to the driver's live memory */
+	UINT8 *					log;					/* one copy per recorded segment */
+	UINT32					bytes;					/* size of the block */
+};
+
+
 typedef struct _screen_state screen_state;
 struct _screen_state
 {
@@ -69,6 +81,15 @@ struct _screen_state
 	UINT8					changed;				/* has this bitmap changed? */
 	INT32					last_partial_scan;		/* scanline of last partial update */
 
+	/* coalesced partial updates */
+	partial_state			partial[MAX_PARTIAL_STATE]; /* memory that VIDEO_UPDATE depends on */
+	int						partial_count;			/* number of registered blocks; 0 disables coalescing */
+	rectangle				pending_clip;			/* range accepted but not yet drawn */
+	UINT8					pending;				/* TRUE if pending_clip is valid */
+	UINT8					replaying;				/* TRUE while VIDEO_UPDATE draws the pending range */
+	int						segcount;				/* number of recorded segments */
+	int						segstart[MAX_PARTIAL_SEGMENTS]; /* first scanline of each segment */
+
 	/* screen timing */
 	attoseconds_t			frame_period;			/* attoseconds per frame */
 	attoseconds_t			scantime;				/* attoseconds per scanline */
@@ -143,6 +164,9 @@ struct _video_global
 	/* snapshot stuff */
 	render_target *			snap_target;			/* screen shapshot target */
 	bitmap_t *				snap_bitmap;			/* screen snapshot bitmap */
+	bitmap_t *				snap_direct;			/* wrapper around a screen bitmap used as-is */
+	bitmap_t *				snap_frame;				/* whichever of the two holds the last snapshot */
+	osd_work_queue *		snap_queue;				/* work queue for rendering snapshots */
 	UINT8					snap_native;			/* are we using native per-screen layouts? */
 	INT32					snap_width;				/* width of snapshots (0 == auto) */
 	INT32					snap_height;			/* height of snapshots (0 == auto) */
@@ -195,6 +219,8 @@ static void init_buffered_spriteram(running_machine *machine);
 static void allocate_graphics(running_machine *machine, const gfx_decode_entry *gfxdecodeinfo);
 
 static void realloc_screen_bitmaps(const device_config *screen);
+static int screen_render_partial(const device_config *screen, const rectangle *clip);
+static void screen_flush_pending(const device_config *screen);
 static STATE_POSTLOAD( video_screen_postload );
 
 /* global rendering */
@@ -225,7 +251,7 @@ static void video_update_burnin(running_machine *machine);
 static void video_finalize_burnin(const device_config *screen);
 
 /* software rendering */
-static void rgb888_draw_primitives(const render_primitive *primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch);
+static void rgb888_draw_primitives(const render_primitive *primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, osd_work_queue *queue);
 
 #ifdef USE_SCALE_EFFECTS
 static void realloc_scale_bitmaps(const device_config *screen);
@@ -386,6 +412,9 @@ void video_init(running_machine *machine)
 		render_target_set_layer_config(global.snap_target, render_target_get_layer_config(global.snap_target) & ~LAYER_CONFIG_ENABLE_SCREEN_OVERLAY);
 	}
 
+	/* snapshots and movies are rendered in software, so spread the work out */
+	global.snap_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	/* extract snap resolution if present */
 	if (sscanf(options_get_string(mame_options(), OPTION_SNAPSIZE), "%dx%d", &global.snap_width, &global.snap_height) != 2)
 		global.snap_width = global.snap_height = 0;
@@ -440,6 +469,10 @@ static void video_exit(running_machine *machine)
 		render_target_free(global.snap_target);
 	if (global.snap_bitmap != NULL)
 		bitmap_free(global.snap_bitmap);
+	if (global.snap_direct != NULL)
+		bitmap_free(global.snap_direct);
+	if (global.snap_queue != NULL)
+		osd_work_queue_free(global.snap_queue);
 
 	/* print a final result if we have at least 5 seconds' worth of data */
 	if (global.overall_emutime.seconds >= 5)
@@ -899,19 +932,57 @@ int video_screen_update_partial(const device_config *screen, int scanline)
 	/* render if necessary */
 	if (clip.min_y <= clip.max_y)
 	{
-		UINT32 flags = UPDATE_HAS_NOT_CHANGED;
+		/* if coalescing, record the state for this range; nothing is drawn until the flush */
+		if (state->partial_count > 0)
+		{
+			int segnum = state->segcount - 1;
+			int blocknum;
 
-		profiler_mark_start(PROFILER_VIDEO);
-		LOG_PARTIAL_UPDATES(("updating %d-%d\n", clip.min_y, clip.max_y));
+			/* a range whose state matches the last segment just extends it */
+			if (state->pending)
+			{
+				for (blocknum = 0; blocknum < state->partial_count; blocknum++)
+				{
+					partial_state *block = &state->partial[blocknum];
+					if (memcmp(block->base, block->log + segnum * block->bytes, block->bytes) != 0)
+						break;
+				}
+				if (blocknum == state->partial_count)
+				{
+					LOG_PARTIAL_UPDATES(("deferred %d-%d\n", clip.min_y, clip.max_y));
+					state->pending_clip.max_y = clip.max_y;
+					state->last_partial_scan = scanline + 1;
+					return TRUE;
+				}
 
-		if (screen->machine->config->video_update != NULL)
-			flags = (*screen->machine->config->video_update)(screen, state->bitmap[state->curbitmap], &clip);
-		global.partial_updates_this_frame++;
-		profiler_mark_end();
+				/* out of room for segments: draw what we have and start over */
+				if (state->segcount == MAX_PARTIAL_SEGMENTS)
+					screen_flush_pending(screen);
+			}
 
-		/* if we modified the bitmap, we have to commit */
-		state->changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
-		result = TRUE;
+			/* start a new segment with the current state */
+			LOG_PARTIAL_UPDATES(("recorded %d-%d\n", clip.min_y, clip.max_y));
+			if (!state->pending)
+			{
+				state->pending_clip = clip;
+				state->pending = TRUE;
+				state->segcount = 0;
+			}
+			state->pending_clip.max_y = clip.max_y;
+			segnum = state->segcount++;
+			state->segstart[segnum] = clip.min_y;
+			for (blocknum = 0; blocknum < state->partial_count; blocknum++)
+			{
+				partial_state *block = &state->partial[blocknum];
+				memcpy(block->log + segnum * block->bytes, block->base, block->bytes);
+			}
+			result = TRUE;
+		}
+		else
+		{
+			LOG_PARTIAL_UPDATES(("updating %d-%d\n", clip.min_y, clip.max_y));
+			result = screen_render_partial(screen, &clip);
+		}
 	}
 
 	/* remember where we left off */
@@ -920,6 +991,111 @@ int video_screen_update_partial(const device_config *screen, int scanline)
 }
 
 
+/*-------------------------------------------------
+    video_screen_register_partial_state - opt a
+    screen into coalesced partial updates by
+    registering a block of memory that its
+    VIDEO_UPDATE depends on
+-------------------------------------------------*/
+
+void video_screen_register_partial_state(const device_config *screen, void *base, UINT32 bytes)
+{
+	screen_state *state = get_safe_token(screen);
+	partial_state *block;
+
+	assert_always(state->partial_count < MAX_PARTIAL_STATE, "Too many partial update state blocks");
+
+	block = &state->partial[state->partial_count++];
+	block->base = base;
+	block->bytes = bytes;
+	block->log = auto_alloc_array(screen->machine, UINT8, bytes * MAX_PARTIAL_SEGMENTS);
+}
+
+
+/*-------------------------------------------------
+    video_screen_get_partial_state - return the
+    copy of a registered block that applies to
+    a scanline, and the last scanline it applies
+    to; outside of a replay this is the live
+    memory
+-------------------------------------------------*/
+
+const void *video_screen_get_partial_state(const device_config *screen, int blocknum, int scanline, int *lastline)
+{
+	screen_state *state = get_safe_token(screen);
+	partial_state *block = &state->partial[blocknum];
+	int segnum;
+
+	assert(blocknum >= 0 && blocknum < state->partial_count);
+
+	/* direct updates just see the live state */
+	if (!state->replaying)
+	{
+		if (lastline != NULL)
+			*lastline = state->visarea.max_y;
+		return block->base;
+	}
+
+	/* find the last segment starting at or before the scanline */
+	for (segnum = state->segcount - 1; segnum > 0; segnum--)
+		if (state->segstart[segnum] <= scanline)
+			break;
+
+	if (lastline != NULL)
+		*lastline = (segnum + 1 < state->segcount) ? state->segstart[segnum + 1] - 1 : state->pending_clip.max_y;
+	return block->log + segnum * block->bytes;
+}
+
+
+/*-------------------------------------------------
+    screen_render_partial - call VIDEO_UPDATE for
+    a range of scanlines
+-------------------------------------------------*/
+
+static int screen_render_partial(const device_config *screen, const rectangle *clip)
+{
+	screen_state *state = get_safe_token(screen);
+	UINT32 flags = UPDATE_HAS_NOT_CHANGED;
+
+	profiler_mark_start(PROFILER_VIDEO);
+
+	if (screen->machine->config->video_update != NULL)
+		flags = (*screen->machine->config->video_update)(screen, state->bitmap[state->curbitmap], clip);
+	global.partial_updates_this_frame++;
+	profiler_mark_end();
+
+	/* if we modified the bitmap, we have to commit */
+	state->changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+	return TRUE;
+}
+
+
+/*-------------------------------------------------
+    screen_flush_pending - draw the pending range
+    of a coalescing screen in a single call to
+    VIDEO_UPDATE, which reads the recorded state
+    of each scanline back through
+    video_screen_get_partial_state
+-------------------------------------------------*/
+
+static void screen_flush_pending(const device_config *screen)
+{
+	screen_state *state = get_safe_token(screen);
+
+	if (!state->pending)
+		return;
+	state->pending = FALSE;
+
+	LOG_PARTIAL_UPDATES(("Partial: replaying %d-%d in %d segments\n", state->pending_clip.min_y, state->pending_clip.max_y, state->segcount));
+
+	/* the live memory is never touched, so VIDEO_UPDATE is free to write to it */
+	state->replaying = TRUE;
+	screen_render_partial(screen, &state->pending_clip);
+	state->replaying = FALSE;
+	state->segcount = 0;
+}
+
+
 /*-------------------------------------------------
     video_screen_update_now - perform an update
     from the last beam position up to the current
@@ -1502,6 +1678,7 @@ static TIMER_CALLBACK( scanline0_callback )
 	screen_state *state = get_safe_token(screen);
 
 	/* reset partial updates */
+	screen_flush_pending(screen);
 	state->last_partial_scan = 0;
 	global.partial_updates_this_frame = 0;
 
@@ -1573,6 +1750,9 @@ void video_frame_update(running_machine *machine, int debug)
 	osd_update(machine, !debug && skipped_it);
 	profiler_mark_end();
 
+	/* decoded graphics handed out during this frame may now be recycled */
+	gfx_element_cache_end_frame(machine);
+
 	/* perform tasks for this frame */
 	if (!debug)
 		mame_frame_update(machine);
@@ -1618,7 +1798,10 @@ static int finish_screen_updates(running_machine *machine)
 
 	/* finish updating the screens */
 	for (screen = video_screen_first(machine->config); screen != NULL; screen = video_screen_next(screen))
+	{
 		video_screen_update_partial(screen, video_screen_get_visible_area(screen)->max_y);
+		screen_flush_pending(screen);
+	}
 
 	/* now add the quads for all the screens */
 	for (screen = video_screen_first(machine->config); screen != NULL; screen = video_screen_next(screen))
@@ -2281,7 +2464,7 @@ void video_screen_save_snapshot(running_machine *machine, const device_config *s
 
 	/* now do the actual work */
 	palette = (machine->palette != NULL) ? palette_entry_list_adjusted(machine->palette) : NULL;
-	error = png_write_bitmap(mame_core_file(fp), &pnginfo, global.snap_bitmap, machine->config->total_colors, palette);
+	error = png_write_bitmap(mame_core_file(fp), &pnginfo, global.snap_frame, machine->config->total_colors, palette);
 
 	/* free any data allocated */
 	png_free(&pnginfo);
@@ -2340,6 +2523,7 @@ void video_save_active_screen_snapshots(running_machine *machine)
 static void create_snapshot_bitmap(const device_config *screen)
 {
 	const render_primitive_list *primlist;
+	const render_texinfo *direct;
 	INT32 width, height;
 	int view_index;
 
@@ -2357,20 +2541,39 @@ static void create_snapshot_bitmap(const device_config *screen)
 	if (width == 0 || height == 0)
 		render_target_get_minimum_size(global.snap_target, &width, &height);
 	render_target_set_bounds(global.snap_target, width, height, 0);
+	primlist = render_target_get_primitives(global.snap_target);
+	osd_lock_acquire(primlist->lock);
 
-	/* if we don't have a bitmap, or if it's not the right size, allocate a new one */
-	if (global.snap_bitmap == NULL || width != global.snap_bitmap->width || height != global.snap_bitmap->height)
+	/* an RGB32 screen shown 1:1 is already the snapshot; the double-buffered screen bitmap stays put until the next frame */
+	direct = render_primitive_list_get_direct(primlist, width, height);
+	if (direct != NULL)
 	{
-		if (global.snap_bitmap != NULL)
-			bitmap_free(global.snap_bitmap);
-		global.snap_bitmap = bitmap_alloc(width, height, BITMAP_FORMAT_RGB32);
-		assert(global.snap_bitmap != NULL);
+		/* the two screen bitmaps alternate every frame, so just repoint the wrapper */
+		if (global.snap_direct == NULL || global.snap_direct->width != width || global.snap_direct->height != height)
+		{
+			if (global.snap_direct != NULL)
+				bitmap_free(global.snap_direct);
+			global.snap_direct = bitmap_wrap(direct->base, width, height, direct->rowpixels, BITMAP_FORMAT_RGB32);
+		}
+		global.snap_direct->base = direct->base;
+		global.snap_direct->rowpixels = direct->rowpixels;
+		global.snap_frame = global.snap_direct;
 	}
+	else
+	{
+		/* if we don't have a bitmap, or if it's not the right size, allocate a new one */
+		if (global.snap_bitmap == NULL || width != global.snap_bitmap->width || height != global.snap_bitmap->height)
+		{
+			if (global.snap_bitmap != NULL)
+				bitmap_free(global.snap_bitmap);
+			global.snap_bitmap = bitmap_alloc(width, height, BITMAP_FORMAT_RGB32);
+			assert(global.snap_bitmap != NULL);
+		}
 
-	/* render the screen there */
-	primlist = render_target_get_primitives(global.snap_target);
-	osd_lock_acquire(primlist->lock);
-	rgb888_draw_primitives(primlist->head, global.snap_bitmap->base, width, height, global.snap_bitmap->rowpixels);
+		/* render the screen there */
+		rgb888_draw_primitives(primlist->head, global.snap_bitmap->base, width, height, global.snap_bitmap->rowpixels, global.snap_queue);
+		global.snap_frame = global.snap_bitmap;
+	}
 	osd_lock_release(primlist->lock);
 }
 
@@ -2491,7 +2694,7 @@ void video_mng_begin_recording(running_machine *machine, const char *name)
 
 	/* start the capture */
 	rate = (state != NULL) ? ATTOSECONDS_TO_HZ(state->frame_period) : DEFAULT_FRAME_RATE;
-	pngerr = mng_capture_start(mame_core_file(global.mngfile), global.snap_bitmap, rate);
+	pngerr = mng_capture_start(mame_core_file(global.mngfile), global.snap_frame, rate);
 	if (pngerr != PNGERR_NONE)
 	{
 		video_mng_end_recording(machine);
@@ -2560,7 +2763,7 @@ static void video_mng_record_frame(running_machine *machine)
 
 			/* write the next frame */
 			palette = (machine->palette != NULL) ? palette_entry_list_adjusted(machine->palette) : NULL;
-			error = mng_capture_frame(mame_core_file(global.mngfile), &pnginfo, global.snap_bitmap, machine->config->total_colors, palette);
+			error = mng_capture_frame(mame_core_file(global.mngfile), &pnginfo, global.snap_frame, machine->config->total_colors, palette);
 			png_free(&pnginfo);
 			if (error != PNGERR_NONE)
 			{
@@ -2612,8 +2815,8 @@ void video_avi_begin_recording(running_machine *machine, const char *name)
 	info.video_timescale = 1000 * ((state != NULL) ? ATTOSECONDS_TO_HZ(state->frame_period) : DEFAULT_FRAME_RATE);
 	info.video_sampletime = 1000;
 	info.video_numsamples = 0;
-	info.video_width = global.snap_bitmap->width;
-	info.video_height = global.snap_bitmap->height;
+	info.video_width = global.snap_frame->width;
+	info.video_height = global.snap_frame->height;
 	info.video_depth = 24;
 
 	info.audio_format = 0;
@@ -2687,7 +2890,7 @@ static void video_avi_record_frame(running_machine *machine)
 		while (attotime_compare(global.movie_next_frame_time, curtime) <= 0)
 		{
 			/* write the next frame */
-			avierr = avi_append_video_frame_rgb32(global.avifile, global.snap_bitmap);
+			avierr = avi_append_video_frame_rgb32(global.avifile, global.snap_frame);
 			if (avierr != AVIERR_NONE)
 			{
 				video_avi_end_recording(machine);
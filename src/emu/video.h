@@ -167,6 +167,14 @@ int video_screen_update_partial(const device_config *screen, int scanline);
 /* force an update from the last beam position up to the current beam position */
 void video_screen_update_now(const device_config *screen);
 
+/* register memory that the screen's VIDEO_UPDATE depends on; partial updates then only
+   record a copy of it, and the whole frame is drawn in one VIDEO_UPDATE at the end */
+void video_screen_register_partial_state(const device_config *screen, void *base, UINT32 bytes);
+
+/* from VIDEO_UPDATE, return the recorded copy of a registered block in effect at a scanline,
+   and the last scanline that copy applies to */
+const void *video_screen_get_partial_state(const device_config *screen, int blocknum, int scanline, int *lastline);
+
 /* return the current vertical or horizontal position of the beam for a screen */
 int video_screen_get_vpos(const device_config *screen);
 int video_screen_get_hpos(const device_config *screen);
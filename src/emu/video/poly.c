@@ -32,11 +32,18 @@
     CONSTANTS
 ***************************************************************************/
 
-#define SCANLINES_PER_BUCKET			8
+#define MAX_BUCKET_SHIFT				3			/* at most 8 scanlines per work unit */
+#define MIN_BUCKET_SHIFT				0			/* at least 1 scanline per work unit */
+#define SCANLINES_PER_BUCKET			(1 << MAX_BUCKET_SHIFT)
 #define CACHE_LINE_SIZE					64			/* this is a general guess */
-#define TOTAL_BUCKETS					(512 / SCANLINES_PER_BUCKET)
+#define TOTAL_BUCKETS					(512 >> MIN_BUCKET_SHIFT)
 #define UNITS_PER_POLY					(100 / SCANLINES_PER_BUCKET)
 
+/* work unit size adaptation; a batch with fewer units than this is split finer, if each unit has enough pixels */
+#define ADAPT_MIN_UNITS					64
+#define ADAPT_MAX_UNITS					(4 * ADAPT_MIN_UNITS)
+#define ADAPT_MIN_UNIT_PIXELS			512
+
 
 
 /***************************************************************************
@@ -179,8 +186,13 @@ struct _poly_manager
 	UINT8				flags;					/* flags */
 
 	/* buckets */
+	UINT8				bucket_shift;			/* log2 of the scanlines in each bucket and work unit */
 	UINT16				unit_bucket[TOTAL_BUCKETS]; /* buckets for tracking unit usage */
 
+	/* current batch */
+	UINT32				batch_pixels;			/* number of pixels queued since the last wait */
+	UINT32				batch_scanlines;		/* number of scanlines queued since the last wait */
+
 	/* statistics */
 	UINT32				triangles;				/* number of triangles queued */
 	UINT32				quads;					/* number of quads queued */
@@ -206,6 +218,7 @@ struct _poly_manager
 static void **allocate_array(size_t *itemsize, UINT32 itemcount);
 static void free_array(void **array);
 static void *poly_item_callback(void *param, int threadid);
+static void adapt_bucket_size(poly_manager *poly);
 static STATE_PRESAVE( poly_state_presave );
 
 
@@ -304,7 +317,7 @@ INLINE polygon_info *allocate_polygon(poly_manager *poly, int miny, int maxy)
 		poly->polygon_waits++;
 #endif
 	}
-	else if (poly->unit_next + (maxy - miny) / SCANLINES_PER_BUCKET + 2 > poly->unit_count)
+	else if (poly->unit_next + ((maxy - miny) >> poly->bucket_shift) + 2 > poly->unit_count)
 	{
 		poly_wait(poly, "Out of work units");
 #if KEEP_STATISTICS
@@ -335,6 +348,7 @@ poly_manager *poly_alloc(running_machine *machine, int max_polys, size_t extra_d
 	/* allocate the manager itself */
 	poly = alloc_clear_or_die(poly_manager);
 	poly->flags = flags;
+	poly->bucket_shift = MAX_BUCKET_SHIFT;
 
 	/* allocate polygons */
 	poly->polygon_size = sizeof(polygon_info);
@@ -443,8 +457,13 @@ void poly_wait(poly_manager *poly, const char *debug_reason)
 			logerror("Poly:Waited %d cycles for %s\n", (int)time, debug_reason);
 	}
 
+	/* with nothing in flight, we can pick a new work unit size */
+	if (poly->queue != NULL)
+		adapt_bucket_size(poly);
+
 	/* reset the state */
 	poly->polygon_next = poly->unit_next = 0;
+	poly->batch_pixels = poly->batch_scanlines = 0;
 	memset(poly->unit_bucket, 0xff, sizeof(poly->unit_bucket));
 
 	/* we need to preserve the last extra data that was supplied */
@@ -559,13 +578,13 @@ UINT32 poly_render_triangle(poly_manager *poly, void *dest, const rectangle *cli
 	startunit = poly->unit_next;
 	for (curscan = v1yclip; curscan < v3yclip; curscan += scaninc)
 	{
-		UINT32 bucketnum = ((UINT32)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		UINT32 bucketnum = ((UINT32)curscan >> poly->bucket_shift) % TOTAL_BUCKETS;
 		UINT32 unit_index = poly->unit_next++;
 		tri_work_unit *unit = &poly->unit[unit_index]->tri;
 		int extnum;
 
 		/* determine how much to advance to hit the next bucket */
-		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
+		scaninc = (1 << poly->bucket_shift) - ((UINT32)curscan & ((1 << poly->bucket_shift) - 1));
 
 		/* fill in the work unit basics */
 		unit->shared.polygon = polygon;
@@ -662,6 +681,8 @@ UINT32 poly_render_triangle(poly_manager *poly, void *dest, const rectangle *cli
 	/* return the total number of pixels in the triangle */
 	poly->triangles++;
 	poly->pixels += pixels;
+	poly->batch_pixels += pixels;
+	poly->batch_scanlines += v3yclip - v1yclip;
 	return pixels;
 }
 
@@ -725,13 +746,13 @@ UINT32 poly_render_triangle_custom(poly_manager *poly, void *dest, const rectang
 	startunit = poly->unit_next;
 	for (curscan = v1yclip; curscan < v3yclip; curscan += scaninc)
 	{
-		UINT32 bucketnum = ((UINT32)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		UINT32 bucketnum = ((UINT32)curscan >> poly->bucket_shift) % TOTAL_BUCKETS;
 		UINT32 unit_index = poly->unit_next++;
 		tri_work_unit *unit = &poly->unit[unit_index]->tri;
 		int extnum;
 
 		/* determine how much to advance to hit the next bucket */
-		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
+		scaninc = (1 << poly->bucket_shift) - ((UINT32)curscan & ((1 << poly->bucket_shift) - 1));
 
 		/* fill in the work unit basics */
 		unit->shared.polygon = polygon;
@@ -781,6 +802,8 @@ UINT32 poly_render_triangle_custom(poly_manager *poly, void *dest, const rectang
 	/* return the total number of pixels in the object */
 	poly->triangles++;
 	poly->pixels += pixels;
+	poly->batch_pixels += pixels;
+	poly->batch_scanlines += v3yclip - v1yclip;
 	return pixels;
 }
 
@@ -922,13 +945,13 @@ UINT32 poly_render_quad(poly_manager *poly, void *dest, const rectangle *cliprec
 	startunit = poly->unit_next;
 	for (curscan = minyclip; curscan < maxyclip; curscan += scaninc)
 	{
-		UINT32 bucketnum = ((UINT32)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		UINT32 bucketnum = ((UINT32)curscan >> poly->bucket_shift) % TOTAL_BUCKETS;
 		UINT32 unit_index = poly->unit_next++;
 		quad_work_unit *unit = &poly->unit[unit_index]->quad;
 		int extnum;
 
 		/* determine how much to advance to hit the next bucket */
-		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
+		scaninc = (1 << poly->bucket_shift) - ((UINT32)curscan & ((1 << poly->bucket_shift) - 1));
 
 		/* fill in the work unit basics */
 		unit->shared.polygon = polygon;
@@ -1012,6 +1035,8 @@ UINT32 poly_render_quad(poly_manager *poly, void *dest, const rectangle *cliprec
 	/* return the total number of pixels in the triangle */
 	poly->quads++;
 	poly->pixels += pixels;
+	poly->batch_pixels += pixels;
+	poly->batch_scanlines += maxyclip - minyclip;
 	return pixels;
 }
 
@@ -1160,13 +1185,13 @@ UINT32 poly_render_polygon(poly_manager *poly, void *dest, const rectangle *clip
 	startunit = poly->unit_next;
 	for (curscan = minyclip; curscan < maxyclip; curscan += scaninc)
 	{
-		UINT32 bucketnum = ((UINT32)curscan / SCANLINES_PER_BUCKET) % TOTAL_BUCKETS;
+		UINT32 bucketnum = ((UINT32)curscan >> poly->bucket_shift) % TOTAL_BUCKETS;
 		UINT32 unit_index = poly->unit_next++;
 		quad_work_unit *unit = &poly->unit[unit_index]->quad;
 		int extnum;
 
 		/* determine how much to advance to hit the next bucket */
-		scaninc = SCANLINES_PER_BUCKET - (UINT32)curscan % SCANLINES_PER_BUCKET;
+		scaninc = (1 << poly->bucket_shift) - ((UINT32)curscan & ((1 << poly->bucket_shift) - 1));
 
 		/* fill in the work unit basics */
 		unit->shared.polygon = polygon;
@@ -1250,6 +1275,8 @@ UINT32 poly_render_polygon(poly_manager *poly, void *dest, const rectangle *clip
 	/* return the total number of pixels in the triangle */
 	poly->quads++;
 	poly->pixels += pixels;
+	poly->batch_pixels += pixels;
+	poly->batch_scanlines += maxyclip - minyclip;
 	return pixels;
 }
 
@@ -1412,6 +1439,39 @@ static void *poly_item_callback(void *param, int threadid)
 }
 
 
+/*-------------------------------------------------
+    adapt_bucket_size - choose the number of
+    scanlines per work unit for the next batch
+    based on the one that just completed; this
+    must only be called when no work is pending,
+    since units of different sizes would not
+    share buckets correctly
+-------------------------------------------------*/
+
+static void adapt_bucket_size(poly_manager *poly)
+{
+	UINT32 units = poly->unit_next;
+
+	if (units == 0)
+		return;
+
+	/* too few units to keep all threads busy: split finer, as long as the units stay worthwhile and fit */
+	if (units < ADAPT_MIN_UNITS && poly->bucket_shift > MIN_BUCKET_SHIFT)
+	{
+		UINT32 newunits = (poly->batch_scanlines >> (poly->bucket_shift - 1)) + 2 * poly->polygon_next;
+		if (poly->batch_pixels / units >= 2 * ADAPT_MIN_UNIT_PIXELS && newunits <= poly->unit_count)
+			poly->bucket_shift--;
+	}
+
+	/* plenty of units, or too little work in each: merge back toward full buckets */
+	else if (poly->bucket_shift < MAX_BUCKET_SHIFT)
+	{
+		if (units > ADAPT_MAX_UNITS || poly->batch_pixels / units < ADAPT_MIN_UNIT_PIXELS)
+			poly->bucket_shift++;
+	}
+}
+
+
 /*-------------------------------------------------
     poly_state_presave - pre-save callback to
     ensure everything is synced before saving
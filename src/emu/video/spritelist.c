@@ -0,0 +1,376 @@
+/***************************************************************************
+
+    spritelist.c
+
+    Shared sprite list with per-scanline bucketing.
+
+    Copyright Nicola Salmoria and the MAME Team.
+    Visit http://mamedev.org for licensing and usage restrictions.
+
+***************************************************************************/
+
+#include "driver.h"
+#include "spritelist.h"
+#include "profiler.h"
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* each bucket covers this many scanlines */
+#define BUCKET_SHIFT			3
+#define BUCKET_HEIGHT			(1 << BUCKET_SHIFT)
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* a single queued sprite */
+typedef struct _sprite_entry sprite_entry;
+struct _sprite_entry
+{
+	const gfx_element *	gfx;					/* graphics element */
+	UINT32				code;					/* tile code */
+	UINT32				color;					/* color */
+	INT32				destx, desty;			/* top-left position */
+	UINT32				scalex, scaley;			/* 16.16 zoom factors */
+	UINT32				pmask;					/* priority mask, if priority is set */
+	UINT32				trans;					/* transparent pen, or mask of transparent pens */
+	INT32				minx, maxx;				/* horizontal extent, inclusive */
+	INT32				miny, maxy;				/* vertical extent, inclusive */
+	UINT8				flipx, flipy;			/* flip flags */
+	UINT8				priority;				/* TRUE to draw against the priority bitmap */
+	UINT8				transmask;				/* TRUE if trans is a mask of pens */
+};
+
+
+/* the sprite list itself */
+struct _sprite_list
+{
+	running_machine *	machine;				/* owning machine */
+
+	sprite_entry *		entry;					/* array of sprites, in drawing order */
+	int					count;					/* number of sprites in the list */
+	int					max;					/* number of allocated entries */
+
+	int					buckets;				/* number of scanline buckets */
+	int					valid;					/* TRUE if the buckets match the entries */
+	UINT32 *			bucket_start;			/* first index for each bucket (buckets + 1 entries) */
+	UINT32 *			bucket_fill;			/* fill cursor per bucket while building */
+	UINT32 *			index;					/* sprite indexes, grouped by bucket */
+	UINT32				index_max;				/* number of allocated indexes */
+};
+
+
+
+/***************************************************************************
+    FUNCTION PROTOTYPES
+***************************************************************************/
+
+static sprite_entry *sprite_list_append(sprite_list *list);
+static void sprite_list_build_buckets(sprite_list *list);
+static void sprite_list_draw_entry(sprite_list *list, const sprite_entry *sprite, bitmap_t *dest, const rectangle *cliprect);
+
+
+
+/***************************************************************************
+    LIST MANAGEMENT
+***************************************************************************/
+
+/*-------------------------------------------------
+    sprite_list_alloc - allocate a new sprite
+    list
+-------------------------------------------------*/
+
+sprite_list *sprite_list_alloc(running_machine *machine, int max_sprites)
+{
+	sprite_list *list = auto_alloc_clear(machine, sprite_list);
+
+	list->machine = machine;
+	list->max = MAX(max_sprites, 1);
+	list->entry = auto_alloc_array(machine, sprite_entry, list->max);
+
+	/* bucket by scanline across the primary screen; without one, we always scan linearly */
+	if (machine->primary_screen != NULL)
+	{
+		list->buckets = (video_screen_get_height(machine->primary_screen) + BUCKET_HEIGHT - 1) >> BUCKET_SHIFT;
+		list->bucket_start = auto_alloc_array(machine, UINT32, list->buckets + 1);
+		list->bucket_fill = auto_alloc_array(machine, UINT32, list->buckets);
+		list->index_max = list->max * 2;
+		list->index = auto_alloc_array(machine, UINT32, list->index_max);
+	}
+	return list;
+}
+
+
+/*-------------------------------------------------
+    sprite_list_reset - remove all sprites from a
+    list
+-------------------------------------------------*/
+
+void sprite_list_reset(sprite_list *list)
+{
+	list->count = 0;
+	list->valid = FALSE;
+}
+
+
+/*-------------------------------------------------
+    sprite_list_count - return the number of
+    sprites in a list
+-------------------------------------------------*/
+
+int sprite_list_count(const sprite_list *list)
+{
+	return list->count;
+}
+
+
+
+/***************************************************************************
+    ADDING SPRITES
+***************************************************************************/
+
+/*-------------------------------------------------
+    sprite_list_add - add a sprite drawn with
+    drawgfxzoom_transpen
+-------------------------------------------------*/
+
+void sprite_list_add(sprite_list *list, const gfx_element *gfx, UINT32 code, UINT32 color, int flipx, int flipy,
+		INT32 destx, INT32 desty, UINT32 scalex, UINT32 scaley, UINT32 transpen)
+{
+	sprite_entry *sprite = sprite_list_append(list);
+
+	sprite->gfx = gfx;
+	sprite->code = code;
+	sprite->color = color;
+	sprite->flipx = flipx;
+	sprite->flipy = flipy;
+	sprite->destx = destx;
+	sprite->desty = desty;
+	sprite->scalex = scalex;
+	sprite->scaley = scaley;
+	sprite->pmask = 0;
+	sprite->trans = transpen;
+	sprite->priority = FALSE;
+	sprite->transmask = FALSE;
+
+	/* compute the extent the same way the zoom renderer does */
+	sprite->minx = destx;
+	sprite->maxx = destx + ((scalex * gfx->width + 0x8000) >> 16) - 1;
+	sprite->miny = desty;
+	sprite->maxy = desty + ((scaley * gfx->height + 0x8000) >> 16) - 1;
+}
+
+
+/*-------------------------------------------------
+    sprite_list_add_pri - add a sprite drawn with
+    pdrawgfxzoom_transpen
+-------------------------------------------------*/
+
+void sprite_list_add_pri(sprite_list *list, const gfx_element *gfx, UINT32 code, UINT32 color, int flipx, int flipy,
+		INT32 destx, INT32 desty, UINT32 scalex, UINT32 scaley, UINT32 pmask, UINT32 transpen)
+{
+	sprite_list_add(list, gfx, code, color, flipx, flipy, destx, desty, scalex, scaley, transpen);
+	list->entry[list->count - 1].pmask = pmask;
+	list->entry[list->count - 1].priority = TRUE;
+}
+
+
+/*-------------------------------------------------
+    sprite_list_add_transmask - add a sprite drawn
+    with drawgfxzoom_transmask
+-------------------------------------------------*/
+
+void sprite_list_add_transmask(sprite_list *list, const gfx_element *gfx, UINT32 code, UINT32 color, int flipx, int flipy,
+		INT32 destx, INT32 desty, UINT32 scalex, UINT32 scaley, UINT32 transmask)
+{
+	sprite_list_add(list, gfx, code, color, flipx, flipy, destx, desty, scalex, scaley, transmask);
+	list->entry[list->count - 1].transmask = TRUE;
+}
+
+
+/*-------------------------------------------------
+    sprite_list_add_pri_transmask - add a sprite
+    drawn with pdrawgfxzoom_transmask
+-------------------------------------------------*/
+
+void sprite_list_add_pri_transmask(sprite_list *list, const gfx_element *gfx, UINT32 code, UINT32 color, int flipx, int flipy,
+		INT32 destx, INT32 desty, UINT32 scalex, UINT32 scaley, UINT32 pmask, UINT32 transmask)
+{
+	sprite_list_add_pri(list, gfx, code, color, flipx, flipy, destx, desty, scalex, scaley, pmask, transmask);
+	list->entry[list->count - 1].transmask = TRUE;
+}
+
+
+
+/***************************************************************************
+    RENDERING
+***************************************************************************/
+
+/*-------------------------------------------------
+    sprite_list_draw - draw all sprites that
+    intersect the cliprect, in list order
+-------------------------------------------------*/
+
+void sprite_list_draw(sprite_list *list, bitmap_t *dest, const rectangle *cliprect)
+{
+	rectangle clip;
+	int sprnum;
+
+	if (list->count == 0)
+		return;
+
+	/* make up a cliprect if we weren't given one */
+	if (cliprect != NULL)
+		clip = *cliprect;
+	else
+	{
+		clip.min_x = clip.min_y = 0;
+		clip.max_x = dest->width - 1;
+		clip.max_y = dest->height - 1;
+	}
+
+profiler_mark_start(PROFILER_DRAWGFX);
+
+	/* if the cliprect lies within a single bucket, only look at the sprites in that bucket */
+	if (list->buckets > 0 && clip.min_y >= 0 && (clip.min_y >> BUCKET_SHIFT) == (clip.max_y >> BUCKET_SHIFT) && (clip.max_y >> BUCKET_SHIFT) < list->buckets)
+	{
+		int bucket = clip.min_y >> BUCKET_SHIFT;
+		UINT32 indexnum;
+
+		if (!list->valid)
+			sprite_list_build_buckets(list);
+
+		for (indexnum = list->bucket_start[bucket]; indexnum < list->bucket_start[bucket + 1]; indexnum++)
+			sprite_list_draw_entry(list, &list->entry[list->index[indexnum]], dest, &clip);
+	}
+
+	/* otherwise, walk the whole list */
+	else
+	{
+		for (sprnum = 0; sprnum < list->count; sprnum++)
+			sprite_list_draw_entry(list, &list->entry[sprnum], dest, &clip);
+	}
+
+profiler_mark_end();
+}
+
+
+
+/***************************************************************************
+    INTERNAL HELPERS
+***************************************************************************/
+
+/*-------------------------------------------------
+    sprite_list_append - return a new entry at the
+    end of the list, growing it if needed
+-------------------------------------------------*/
+
+static sprite_entry *sprite_list_append(sprite_list *list)
+{
+	if (list->count == list->max)
+	{
+		list->max *= 2;
+		list->entry = auto_extend_array(list->machine, list->entry, sprite_entry, list->max);
+	}
+
+	list->valid = FALSE;
+	return &list->entry[list->count++];
+}
+
+
+/*-------------------------------------------------
+    sprite_list_build_buckets - sort the sprites
+    into scanline buckets, keeping list order
+    within each bucket
+-------------------------------------------------*/
+
+static void sprite_list_build_buckets(sprite_list *list)
+{
+	int maxbucket = list->buckets - 1;
+	UINT32 total = 0;
+	int sprnum, bucket;
+
+	/* count the sprites that touch each bucket */
+	memset(list->bucket_start, 0, (list->buckets + 1) * sizeof(list->bucket_start[0]));
+	for (sprnum = 0; sprnum < list->count; sprnum++)
+	{
+		const sprite_entry *sprite = &list->entry[sprnum];
+		int first, last;
+
+		if (sprite->maxy < 0 || sprite->miny > sprite->maxy || (sprite->miny >> BUCKET_SHIFT) > maxbucket)
+			continue;
+		first = MAX(sprite->miny, 0) >> BUCKET_SHIFT;
+		last = MIN(sprite->maxy >> BUCKET_SHIFT, maxbucket);
+		for (bucket = first; bucket <= last; bucket++)
+			list->bucket_start[bucket + 1]++;
+	}
+
+	/* convert the counts to starting offsets */
+	for (bucket = 0; bucket < list->buckets; bucket++)
+	{
+		list->bucket_fill[bucket] = total;
+		total += list->bucket_start[bucket + 1];
+		list->bucket_start[bucket + 1] = total;
+	}
+
+	/* make sure we have room for the indexes */
+	if (total > list->index_max)
+	{
+		list->index_max = total * 2;
+		list->index = auto_extend_array(list->machine, list->index, UINT32, list->index_max);
+	}
+
+	/* fill in the indexes in list order */
+	for (sprnum = 0; sprnum < list->count; sprnum++)
+	{
+		const sprite_entry *sprite = &list->entry[sprnum];
+		int first, last;
+
+		if (sprite->maxy < 0 || sprite->miny > sprite->maxy || (sprite->miny >> BUCKET_SHIFT) > maxbucket)
+			continue;
+		first = MAX(sprite->miny, 0) >> BUCKET_SHIFT;
+		last = MIN(sprite->maxy >> BUCKET_SHIFT, maxbucket);
+		for (bucket = first; bucket <= last; bucket++)
+			list->index[list->bucket_fill[bucket]++] = sprnum;
+	}
+
+	list->valid = TRUE;
+}
+
+
+/*-------------------------------------------------
+    sprite_list_draw_entry - draw a single sprite
+    if it intersects the cliprect
+-------------------------------------------------*/
+
+static void sprite_list_draw_entry(sprite_list *list, const sprite_entry *sprite, bitmap_t *dest, const rectangle *cliprect)
+{
+	/* trivially reject sprites outside the cliprect */
+	if (sprite->miny > cliprect->max_y || sprite->maxy < cliprect->min_y ||
+		sprite->minx > cliprect->max_x || sprite->maxx < cliprect->min_x)
+		return;
+
+	if (sprite->priority)
+	{
+		if (sprite->transmask)
+			pdrawgfxzoom_transmask(dest, cliprect, sprite->gfx, sprite->code, sprite->color, sprite->flipx, sprite->flipy,
+					sprite->destx, sprite->desty, sprite->scalex, sprite->scaley, list->machine->priority_bitmap, sprite->pmask, sprite->trans);
+		else
+			pdrawgfxzoom_transpen(dest, cliprect, sprite->gfx, sprite->code, sprite->color, sprite->flipx, sprite->flipy,
+					sprite->destx, sprite->desty, sprite->scalex, sprite->scaley, list->machine->priority_bitmap, sprite->pmask, sprite->trans);
+	}
+	else
+	{
+		if (sprite->transmask)
+			drawgfxzoom_transmask(dest, cliprect, sprite->gfx, sprite->code, sprite->color, sprite->flipx, sprite->flipy,
+					sprite->destx, sprite->desty, sprite->scalex, sprite->scaley, sprite->trans);
+		else
+			drawgfxzoom_transpen(dest, cliprect, sprite->gfx, sprite->code, sprite->color, sprite->flipx, sprite->flipy,
+					sprite->destx, sprite->desty, sprite->scalex, sprite->scaley, sprite->trans);
+	}
+}
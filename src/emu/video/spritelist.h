@@ -0,0 +1,97 @@
+/***************************************************************************
+
+    spritelist.h
+
+    Shared sprite list with per-scanline bucketing.
+
+    Copyright Nicola Salmoria and the MAME Team.
+    Visit http://mamedev.org for licensing and usage restrictions.
+
+****************************************************************************
+
+    Drivers traditionally walk their whole sprite table on every call to
+    VIDEO_UPDATE, even when a partial update only covers a few scanlines.
+    A sprite list lets the driver decode the table once (per frame, or
+    whenever sprite RAM changes) and then draw any number of cliprects
+    from it. Only the sprites that intersect the cliprect are drawn, and
+    they are drawn in the order they were added.
+
+    Typical usage:
+
+        VIDEO_START:
+            state->sprites = sprite_list_alloc(machine, 256);
+
+        whenever the sprite table changes (e.g. at VIDEO_EOF, or on
+        a sprite DMA):
+            sprite_list_reset(state->sprites);
+            for (each sprite, back to front)
+                sprite_list_add(state->sprites, gfx, code, color, flipx,
+                                flipy, sx, sy, 0x10000, 0x10000, 0);
+
+        VIDEO_UPDATE:
+            sprite_list_draw(state->sprites, bitmap, cliprect);
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __SPRITELIST_H__
+#define __SPRITELIST_H__
+
+#include "mamecore.h"
+#include "drawgfx.h"
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* opaque reference to a sprite list */
+typedef struct _sprite_list sprite_list;
+
+
+
+/***************************************************************************
+    FUNCTION PROTOTYPES
+***************************************************************************/
+
+/* ----- list management ----- */
+
+/* allocate a new sprite list; the list grows if more than max_sprites are added */
+sprite_list *sprite_list_alloc(running_machine *machine, int max_sprites);
+
+/* remove all sprites from a list */
+void sprite_list_reset(sprite_list *list);
+
+/* return the number of sprites in a list */
+int sprite_list_count(const sprite_list *list);
+
+
+
+/* ----- adding sprites ----- */
+
+/* add a sprite drawn with drawgfxzoom_transpen */
+void sprite_list_add(sprite_list *list, const gfx_element *gfx, UINT32 code, UINT32 color, int flipx, int flipy,
+		INT32 destx, INT32 desty, UINT32 scalex, UINT32 scaley, UINT32 transpen);
+
+/* add a sprite drawn with pdrawgfxzoom_transpen against machine->priority_bitmap */
+void sprite_list_add_pri(sprite_list *list, const gfx_element *gfx, UINT32 code, UINT32 color, int flipx, int flipy,
+		INT32 destx, INT32 desty, UINT32 scalex, UINT32 scaley, UINT32 pmask, UINT32 transpen);
+
+/* add a sprite drawn with drawgfxzoom_transmask */
+void sprite_list_add_transmask(sprite_list *list, const gfx_element *gfx, UINT32 code, UINT32 color, int flipx, int flipy,
+		INT32 destx, INT32 desty, UINT32 scalex, UINT32 scaley, UINT32 transmask);
+
+/* add a sprite drawn with pdrawgfxzoom_transmask against machine->priority_bitmap */
+void sprite_list_add_pri_transmask(sprite_list *list, const gfx_element *gfx, UINT32 code, UINT32 color, int flipx, int flipy,
+		INT32 destx, INT32 desty, UINT32 scalex, UINT32 scaley, UINT32 pmask, UINT32 transmask);
+
+
+
+/* ----- rendering ----- */
+
+/* draw all sprites that intersect the cliprect, in the order they were added */
+void sprite_list_draw(sprite_list *list, bitmap_t *dest, const rectangle *cliprect);
+
+
+#endif	/* __SPRITELIST_H__ */
@@ -0,0 +1,599 @@
+/***************************************************************************
+
+    tilecomp.c
+
+    Layer-caching tilemap compositor.
+
+    Copyright Nicola Salmoria and the MAME Team.
+    Visit http://mamedev.org for licensing and usage restrictions.
+
+***************************************************************************/
+
+#include "driver.h"
+#include "tilecomp.h"
+#include "profiler.h"
+
+/* use SSE2 for the row mergers on 64-bit implementations, where it can be assumed */
+#if (defined(__SSE2__) && defined(PTR64))
+#include <emmintrin.h>
+#define TILECOMP_SSE2_ROWS
+#endif
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* a single cached layer */
+typedef struct _compositor_layer compositor_layer;
+struct _compositor_layer
+{
+	tilemap *			tmap;					/* tilemap drawn into this layer */
+	UINT32				flags;					/* tilemap_draw flags */
+	UINT8				priority;				/* value ORed into the priority bitmap */
+	UINT8				pmask;					/* mask ANDed with the priority bitmap */
+
+	UINT32				tmapseq;				/* last draw sequence seen from the tilemap */
+	UINT32				generation;				/* bumped whenever the cached pixels go stale */
+	UINT32 *			rowgen;					/* generation each cached row was drawn at */
+
+	bitmap_t *			pixels;					/* scrolled output of the tilemap alone */
+	bitmap_t *			coverage;				/* 1 where the tilemap drew a pixel, 0 elsewhere */
+	bitmap_t *			composite;				/* background plus all layers up to this one */
+	bitmap_t *			compositepri;			/* priority bitmap matching composite */
+};
+
+
+/* the compositor itself */
+struct _tilemap_compositor
+{
+	tilemap_compositor *next;					/* next compositor in the global list */
+	running_machine *	machine;				/* owning machine */
+	palette_client *	palclient;				/* client to the system palette */
+
+	int					numlayers;				/* number of layers added */
+	compositor_layer	layer[TILEMAP_COMPOSITOR_MAX_LAYERS]; /* layers, back to front */
+
+	pen_t				bgpen;					/* pen for uncovered pixels */
+	int					bgdirty;				/* TRUE if bgrow must be refilled */
+
+	bitmap_format		format;					/* format of the cached bitmaps */
+	int					width, height;			/* size of the cached bitmaps */
+	rectangle			visarea;				/* horizontal range kept in the caches */
+	UINT8 *				validlayers;			/* per row: number of composites that are current */
+	UINT32 *			bgrow;					/* one row of background pixels */
+	UINT8 *				bgpri;					/* one row of zero priority */
+};
+
+
+
+/***************************************************************************
+    GLOBAL VARIABLES
+***************************************************************************/
+
+static tilemap_compositor *compositor_list;
+
+
+
+/***************************************************************************
+    FUNCTION PROTOTYPES
+***************************************************************************/
+
+static void tilemap_compositor_exit(running_machine *machine);
+static void compositor_free_caches(tilemap_compositor *comp);
+static bitmap_t *compositor_alloc_bitmap(int width, int height, bitmap_format format);
+static void compositor_update_caches(tilemap_compositor *comp, bitmap_t *dest);
+static void compositor_draw_layer_rows(tilemap_compositor *comp, int layernum, int miny, int maxy);
+static void compositor_merge_row(tilemap_compositor *comp, int layernum, int y);
+
+
+
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
+
+/*-------------------------------------------------
+    merge_row16 - merge a layer row over a 16bpp
+    row wherever the layer has coverage
+-------------------------------------------------*/
+
+INLINE void merge_row16(UINT16 *dest, const UINT16 *below, const UINT16 *source, const UINT8 *cov, int count)
+{
+	int i = 0;
+
+#ifdef TILECOMP_SSE2_ROWS
+	__m128i zero = _mm_setzero_si128();
+
+	/* 16 pixels at a time */
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i m8 = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)&cov[i]), zero);
+		__m128i mlo = _mm_unpacklo_epi8(m8, m8);
+		__m128i mhi = _mm_unpackhi_epi8(m8, m8);
+		__m128i blo = _mm_loadu_si128((const __m128i *)&below[i]);
+		__m128i bhi = _mm_loadu_si128((const __m128i *)&below[i + 8]);
+		__m128i slo = _mm_loadu_si128((const __m128i *)&source[i]);
+		__m128i shi = _mm_loadu_si128((const __m128i *)&source[i + 8]);
+		_mm_storeu_si128((__m128i *)&dest[i], _mm_or_si128(_mm_and_si128(mlo, slo), _mm_andnot_si128(mlo, blo)));
+		_mm_storeu_si128((__m128i *)&dest[i + 8], _mm_or_si128(_mm_and_si128(mhi, shi), _mm_andnot_si128(mhi, bhi)));
+	}
+#endif
+
+	for ( ; i < count; i++)
+		dest[i] = cov[i] ? source[i] : below[i];
+}
+
+
+/*-------------------------------------------------
+    merge_row32 - merge a layer row over a 32bpp
+    row wherever the layer has coverage
+-------------------------------------------------*/
+
+INLINE void merge_row32(UINT32 *dest, const UINT32 *below, const UINT32 *source, const UINT8 *cov, int count)
+{
+	int i = 0;
+
+#ifdef TILECOMP_SSE2_ROWS
+	__m128i zero = _mm_setzero_si128();
+
+	/* 16 pixels at a time, widening the coverage mask to 32 bits in four steps */
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i m8 = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)&cov[i]), zero);
+		__m128i m16[2];
+		int j;
+
+		m16[0] = _mm_unpacklo_epi8(m8, m8);
+		m16[1] = _mm_unpackhi_epi8(m8, m8);
+		for (j = 0; j < 4; j++)
+		{
+			__m128i m = (j & 1) ? _mm_unpackhi_epi16(m16[j >> 1], m16[j >> 1]) : _mm_unpacklo_epi16(m16[j >> 1], m16[j >> 1]);
+			__m128i b = _mm_loadu_si128((const __m128i *)&below[i + j * 4]);
+			__m128i s = _mm_loadu_si128((const __m128i *)&source[i + j * 4]);
+			_mm_storeu_si128((__m128i *)&dest[i + j * 4], _mm_or_si128(_mm_and_si128(m, s), _mm_andnot_si128(m, b)));
+		}
+	}
+#endif
+
+	for ( ; i < count; i++)
+		dest[i] = cov[i] ? source[i] : below[i];
+}
+
+
+/*-------------------------------------------------
+    merge_row_priority - apply a layer's priority
+    and priority mask to a priority row wherever
+    the layer has coverage, as tilemap_draw_primask
+    would
+-------------------------------------------------*/
+
+INLINE void merge_row_priority(UINT8 *dest, const UINT8 *below, const UINT8 *cov, int count, UINT8 priority, UINT8 pmask)
+{
+	int i = 0;
+
+#ifdef TILECOMP_SSE2_ROWS
+	__m128i zero = _mm_setzero_si128();
+	__m128i andmask = _mm_set1_epi8((char)pmask);
+	__m128i ormask = _mm_set1_epi8((char)priority);
+
+	/* 16 pixels at a time */
+	for ( ; i + 16 <= count; i += 16)
+	{
+		__m128i m = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)&cov[i]), zero);
+		__m128i p = _mm_loadu_si128((const __m128i *)&below[i]);
+		__m128i newp = _mm_or_si128(_mm_and_si128(p, andmask), ormask);
+		_mm_storeu_si128((__m128i *)&dest[i], _mm_or_si128(_mm_and_si128(m, newp), _mm_andnot_si128(m, p)));
+	}
+#endif
+
+	for ( ; i < count; i++)
+		dest[i] = cov[i] ? ((below[i] & pmask) | priority) : below[i];
+}
+
+
+
+/***************************************************************************
+    COMPOSITOR MANAGEMENT
+***************************************************************************/
+
+/*-------------------------------------------------
+    tilemap_compositor_alloc - allocate a new
+    compositor
+-------------------------------------------------*/
+
+tilemap_compositor *tilemap_compositor_alloc(running_machine *machine)
+{
+	tilemap_compositor *comp = auto_alloc_clear(machine, tilemap_compositor);
+
+	/* the first compositor for this machine hooks the exit to free the caches */
+	if (compositor_list == NULL)
+		add_exit_callback(machine, tilemap_compositor_exit);
+	comp->next = compositor_list;
+	compositor_list = comp;
+
+	comp->machine = machine;
+	comp->bgdirty = TRUE;
+
+	/* RGB caches bake in palette colors, so we need to hear about palette changes */
+	if (machine->palette != NULL)
+		comp->palclient = palette_client_alloc(machine->palette);
+	return comp;
+}
+
+
+/*-------------------------------------------------
+    tilemap_compositor_set_background - set the
+    pen used where no layer covers a pixel
+-------------------------------------------------*/
+
+void tilemap_compositor_set_background(tilemap_compositor *comp, pen_t pen)
+{
+	if (comp->bgpen != pen)
+	{
+		comp->bgpen = pen;
+		comp->bgdirty = TRUE;
+	}
+}
+
+
+/*-------------------------------------------------
+    tilemap_compositor_invalidate - forget all
+    cached pixels
+-------------------------------------------------*/
+
+void tilemap_compositor_invalidate(tilemap_compositor *comp)
+{
+	int layernum;
+
+	for (layernum = 0; layernum < comp->numlayers; layernum++)
+		comp->layer[layernum].generation++;
+	comp->bgdirty = TRUE;
+}
+
+
+
+/***************************************************************************
+    LAYER MANAGEMENT
+***************************************************************************/
+
+/*-------------------------------------------------
+    tilemap_compositor_add_layer - add a layer on
+    top of the existing ones
+-------------------------------------------------*/
+
+int tilemap_compositor_add_layer(tilemap_compositor *comp, tilemap *tmap, UINT32 flags, UINT8 priority, UINT8 priority_mask)
+{
+	int layernum = comp->numlayers;
+
+	assert_always(layernum < TILEMAP_COMPOSITOR_MAX_LAYERS, "Too many tilemap compositor layers");
+
+	comp->numlayers++;
+	comp->layer[layernum].generation = 1;
+	tilemap_compositor_set_layer(comp, layernum, tmap, flags, priority, priority_mask);
+
+	/* if the caches already exist, this layer needs its own */
+	if (comp->validlayers != NULL)
+		comp->width = 0;
+	return layernum;
+}
+
+
+/*-------------------------------------------------
+    tilemap_compositor_set_layer - change the
+    tilemap or draw parameters of a layer
+-------------------------------------------------*/
+
+void tilemap_compositor_set_layer(tilemap_compositor *comp, int layernum, tilemap *tmap, UINT32 flags, UINT8 priority, UINT8 priority_mask)
+{
+	compositor_layer *layer = &comp->layer[layernum];
+
+	assert(layernum >= 0 && layernum < comp->numlayers);
+	assert(tmap != NULL);
+	assert_always((flags & TILEMAP_DRAW_ALPHA_FLAG) == 0, "Alpha-blended layers cannot be cached by a tilemap compositor");
+
+	if (layer->tmap != tmap || layer->flags != flags || layer->priority != priority || layer->pmask != priority_mask)
+	{
+		layer->tmap = tmap;
+		layer->flags = flags;
+		layer->priority = priority;
+		layer->pmask = priority_mask;
+		layer->generation++;
+	}
+}
+
+
+
+/***************************************************************************
+    RENDERING
+***************************************************************************/
+
+/*-------------------------------------------------
+    tilemap_compositor_draw - draw all layers into
+    the cliprect of dest and fill the priority
+    bitmap to match
+-------------------------------------------------*/
+
+void tilemap_compositor_draw(tilemap_compositor *comp, bitmap_t *dest, const rectangle *cliprect)
+{
+	bitmap_t *priority_bitmap = comp->machine->priority_bitmap;
+	int layernum, x0, count, y, miny, maxy;
+
+	/* bring the cache geometry and palette state up to date */
+	compositor_update_caches(comp, dest);
+
+	/* clip the rows to the cached area; the cached columns always span the visible area */
+	miny = MAX(cliprect->min_y, comp->visarea.min_y);
+	maxy = MIN(cliprect->max_y, comp->visarea.max_y);
+	x0 = MAX(cliprect->min_x, comp->visarea.min_x);
+	count = MIN(cliprect->max_x, comp->visarea.max_x) + 1 - x0;
+	if (miny > maxy || count <= 0)
+		return;
+
+	/* redraw the stale rows of each layer, one run of consecutive rows at a time */
+	for (layernum = 0; layernum < comp->numlayers; layernum++)
+	{
+		compositor_layer *layer = &comp->layer[layernum];
+		UINT32 seq = tilemap_get_draw_seq(layer->tmap, &comp->visarea);
+
+		if (seq != layer->tmapseq)
+		{
+			layer->tmapseq = seq;
+			layer->generation++;
+		}
+
+		for (y = miny; y <= maxy; y++)
+			if (layer->rowgen[y] != layer->generation)
+			{
+				int runstart = y;
+				while (y + 1 <= maxy && layer->rowgen[y + 1] != layer->generation)
+					y++;
+				compositor_draw_layer_rows(comp, layernum, runstart, y);
+			}
+	}
+
+profiler_mark_start(PROFILER_TILEMAP_DRAW);
+	for (y = miny; y <= maxy; y++)
+	{
+		const void *source;
+		const UINT8 *sourcepri;
+
+		/* merge from the lowest stale composite upward */
+		for (layernum = comp->validlayers[y]; layernum < comp->numlayers; layernum++)
+			compositor_merge_row(comp, layernum, y);
+		comp->validlayers[y] = comp->numlayers;
+
+		/* copy the top composite out to the destination and priority bitmaps */
+		if (comp->numlayers == 0)
+		{
+			source = (comp->format == BITMAP_FORMAT_RGB32) ? (const void *)&comp->bgrow[x0] : (const void *)&((const UINT16 *)comp->bgrow)[x0];
+			sourcepri = &comp->bgpri[x0];
+		}
+		else
+		{
+			compositor_layer *top = &comp->layer[comp->numlayers - 1];
+			source = (comp->format == BITMAP_FORMAT_RGB32) ? (const void *)BITMAP_ADDR32(top->composite, y, x0) : (const void *)BITMAP_ADDR16(top->composite, y, x0);
+			sourcepri = BITMAP_ADDR8(top->compositepri, y, x0);
+		}
+
+		if (dest->bpp == 32)
+			memcpy(BITMAP_ADDR32(dest, y, x0), source, count * 4);
+		else
+			memcpy(BITMAP_ADDR16(dest, y, x0), source, count * 2);
+		if (priority_bitmap != NULL && y < priority_bitmap->height && x0 + count <= priority_bitmap->width)
+			memcpy(BITMAP_ADDR8(priority_bitmap, y, x0), sourcepri, count);
+	}
+profiler_mark_end();
+}
+
+
+
+/***************************************************************************
+    INTERNAL HELPERS
+***************************************************************************/
+
+/*-------------------------------------------------
+    tilemap_compositor_exit - free the caches and
+    palette clients of all compositors
+-------------------------------------------------*/
+
+static void tilemap_compositor_exit(running_machine *machine)
+{
+	tilemap_compositor *comp;
+
+	for (comp = compositor_list; comp != NULL; comp = comp->next)
+	{
+		compositor_free_caches(comp);
+		if (comp->palclient != NULL)
+			palette_client_free(comp->palclient);
+		comp->palclient = NULL;
+	}
+	compositor_list = NULL;
+}
+
+
+/*-------------------------------------------------
+    compositor_free_caches - free all cached
+    bitmaps and row state
+-------------------------------------------------*/
+
+static void compositor_free_caches(tilemap_compositor *comp)
+{
+	int layernum;
+
+	for (layernum = 0; layernum < TILEMAP_COMPOSITOR_MAX_LAYERS; layernum++)
+	{
+		compositor_layer *layer = &comp->layer[layernum];
+
+		if (layer->pixels != NULL)
+			bitmap_free(layer->pixels);
+		if (layer->coverage != NULL)
+			bitmap_free(layer->coverage);
+		if (layer->composite != NULL)
+			bitmap_free(layer->composite);
+		if (layer->compositepri != NULL)
+			bitmap_free(layer->compositepri);
+		if (layer->rowgen != NULL)
+			free(layer->rowgen);
+		layer->pixels = layer->coverage = layer->composite = layer->compositepri = NULL;
+		layer->rowgen = NULL;
+	}
+
+	if (comp->validlayers != NULL)
+		free(comp->validlayers);
+	if (comp->bgrow != NULL)
+		free(comp->bgrow);
+	if (comp->bgpri != NULL)
+		free(comp->bgpri);
+	comp->validlayers = NULL;
+	comp->bgrow = NULL;
+	comp->bgpri = NULL;
+	comp->width = comp->height = 0;
+}
+
+
+/*-------------------------------------------------
+    compositor_alloc_bitmap - allocate one cache
+    bitmap or die trying
+-------------------------------------------------*/
+
+static bitmap_t *compositor_alloc_bitmap(int width, int height, bitmap_format format)
+{
+	bitmap_t *bitmap = bitmap_alloc(width, height, format);
+	if (bitmap == NULL)
+		fatalerror("Out of memory allocating tilemap compositor caches");
+	return bitmap;
+}
+
+
+/*-------------------------------------------------
+    compositor_update_caches - (re)allocate the
+    caches to match the destination and drop
+    anything the tilemaps cannot track
+-------------------------------------------------*/
+
+static void compositor_update_caches(tilemap_compositor *comp, bitmap_t *dest)
+{
+	const device_config *screen = comp->machine->primary_screen;
+	rectangle visarea;
+	int layernum;
+
+	assert(dest->format == BITMAP_FORMAT_INDEXED16 || dest->format == BITMAP_FORMAT_RGB15 || dest->format == BITMAP_FORMAT_RGB32);
+
+	/* reallocate everything if the destination changed shape */
+	if (comp->width != dest->width || comp->height != dest->height || comp->format != dest->format)
+	{
+		compositor_free_caches(comp);
+		comp->format = dest->format;
+		comp->width = dest->width;
+		comp->height = dest->height;
+
+		for (layernum = 0; layernum < comp->numlayers; layernum++)
+		{
+			compositor_layer *layer = &comp->layer[layernum];
+
+			layer->pixels = compositor_alloc_bitmap(comp->width, comp->height, comp->format);
+			layer->coverage = compositor_alloc_bitmap(comp->width, comp->height, BITMAP_FORMAT_INDEXED8);
+			layer->composite = compositor_alloc_bitmap(comp->width, comp->height, comp->format);
+			layer->compositepri = compositor_alloc_bitmap(comp->width, comp->height, BITMAP_FORMAT_INDEXED8);
+			layer->rowgen = alloc_array_clear_or_die(UINT32, comp->height);
+		}
+		comp->validlayers = alloc_array_clear_or_die(UINT8, comp->height);
+		comp->bgrow = alloc_array_or_die(UINT32, comp->width);
+		comp->bgpri = alloc_array_clear_or_die(UINT8, comp->width);
+		comp->visarea.min_x = comp->visarea.min_y = 0;
+		comp->visarea.max_x = comp->visarea.max_y = -1;
+	}
+
+	/* cache the visible part of the primary screen, or the whole bitmap without one */
+	visarea.min_x = visarea.min_y = 0;
+	visarea.max_x = comp->width - 1;
+	visarea.max_y = comp->height - 1;
+	if (screen != NULL)
+		sect_rect(&visarea, video_screen_get_visible_area(screen));
+	if (visarea.min_x != comp->visarea.min_x || visarea.max_x != comp->visarea.max_x ||
+		visarea.min_y != comp->visarea.min_y || visarea.max_y != comp->visarea.max_y)
+	{
+		comp->visarea = visarea;
+		tilemap_compositor_invalidate(comp);
+	}
+
+	/* RGB caches hold resolved colors, so any palette change spoils them */
+	if (comp->palclient != NULL && palette_client_get_dirty_list(comp->palclient, NULL, NULL) != NULL && comp->format != BITMAP_FORMAT_INDEXED16)
+		tilemap_compositor_invalidate(comp);
+
+	/* refill the background row and restart every composite from the bottom */
+	if (comp->bgdirty)
+	{
+		pen_t color = (comp->format == BITMAP_FORMAT_INDEXED16) ? comp->bgpen : comp->machine->pens[comp->bgpen];
+		int x;
+
+		if (comp->format == BITMAP_FORMAT_RGB32)
+			for (x = 0; x < comp->width; x++)
+				comp->bgrow[x] = color;
+		else
+			for (x = 0; x < comp->width; x++)
+				((UINT16 *)comp->bgrow)[x] = color;
+		memset(comp->validlayers, 0, comp->height);
+		comp->bgdirty = FALSE;
+	}
+}
+
+
+/*-------------------------------------------------
+    compositor_draw_layer_rows - redraw a run of
+    rows of a single layer across the visible
+    width
+-------------------------------------------------*/
+
+static void compositor_draw_layer_rows(tilemap_compositor *comp, int layernum, int miny, int maxy)
+{
+	compositor_layer *layer = &comp->layer[layernum];
+	rectangle clip;
+	int y;
+
+	clip.min_x = comp->visarea.min_x;
+	clip.max_x = comp->visarea.max_x;
+	clip.min_y = miny;
+	clip.max_y = maxy;
+
+	/* the pixels are only meaningful where the coverage says so, so only coverage needs clearing */
+	bitmap_fill(layer->coverage, &clip, 0);
+	tilemap_draw_coverage(layer->pixels, layer->coverage, &clip, layer->tmap, layer->flags);
+
+	for (y = miny; y <= maxy; y++)
+	{
+		layer->rowgen[y] = layer->generation;
+		if (comp->validlayers[y] > layernum)
+			comp->validlayers[y] = layernum;
+	}
+}
+
+
+/*-------------------------------------------------
+    compositor_merge_row - rebuild one row of a
+    layer's composite from the composite below it
+-------------------------------------------------*/
+
+static void compositor_merge_row(tilemap_compositor *comp, int layernum, int y)
+{
+	compositor_layer *layer = &comp->layer[layernum];
+	int x0 = comp->visarea.min_x;
+	int count = comp->visarea.max_x + 1 - x0;
+	const UINT8 *cov = BITMAP_ADDR8(layer->coverage, y, x0);
+	const UINT8 *belowpri;
+
+	if (comp->format == BITMAP_FORMAT_RGB32)
+	{
+		const UINT32 *below = (layernum == 0) ? &comp->bgrow[x0] : BITMAP_ADDR32(comp->layer[layernum - 1].composite, y, x0);
+		merge_row32(BITMAP_ADDR32(layer->composite, y, x0), below, BITMAP_ADDR32(layer->pixels, y, x0), cov, count);
+	}
+	else
+	{
+		const UINT16 *below = (layernum == 0) ? &((const UINT16 *)comp->bgrow)[x0] : BITMAP_ADDR16(comp->layer[layernum - 1].composite, y, x0);
+		merge_row16(BITMAP_ADDR16(layer->composite, y, x0), below, BITMAP_ADDR16(layer->pixels, y, x0), cov, count);
+	}
+
+	belowpri = (layernum == 0) ? &comp->bgpri[x0] : BITMAP_ADDR8(comp->layer[layernum - 1].compositepri, y, x0);
+	merge_row_priority(BITMAP_ADDR8(layer->compositepri, y, x0), belowpri, cov, count, layer->priority, layer->pmask);
+}
@@ -0,0 +1,114 @@
+/***************************************************************************
+
+    tilecomp.h
+
+    Layer-caching tilemap compositor.
+
+    Copyright Nicola Salmoria and the MAME Team.
+    Visit http://mamedev.org for licensing and usage restrictions.
+
+****************************************************************************
+
+    Most tilemap drivers draw three or four layers back to front on every
+    call to VIDEO_UPDATE, even when a layer's scroll registers and tile
+    contents have not changed since the last frame. A compositor keeps
+    the fully scrolled output of each layer, plus which pixels that layer
+    covers, and only redraws a layer's rows when the tilemap reports that
+    a draw could produce different pixels (visible tile data, scroll,
+    enable, flip or palette offset changed). Tiles written outside the
+    visible area, such as the columns a scrolling game fills in ahead
+    of the scroll, do not count. Layers are then merged from the
+    lowest changed layer upward, so a static background costs nothing
+    beyond a row copy.
+
+    Each layer is added with the same flags, priority and priority mask
+    that would otherwise be passed to tilemap_draw_primask, and the
+    compositor writes machine->priority_bitmap for the cliprect exactly
+    as those calls would have, so sprites drawn afterwards with
+    pdrawgfx still see the right priorities. There is no need to clear
+    the priority bitmap first.
+
+    Layers drawn with TILEMAP_DRAW_ALPHA depend on the pixels below them
+    and cannot be cached; draw those with tilemap_draw after the
+    compositor. Row and column scroll changes invalidate the whole
+    layer, so layers with raster effects still redraw every frame but
+    no longer force the layers below them to redraw.
+
+    Typical usage:
+
+        VIDEO_START:
+            state->comp = tilemap_compositor_alloc(machine);
+            tilemap_compositor_set_background(state->comp, 0);
+            tilemap_compositor_add_layer(state->comp, bg_tilemap, 0, 0, 0xff);
+            tilemap_compositor_add_layer(state->comp, fg_tilemap, 0, 1, 0xff);
+            tilemap_compositor_add_layer(state->comp, tx_tilemap, 0, 2, 0xff);
+
+        VIDEO_UPDATE:
+            tilemap_set_scrollx(bg_tilemap, 0, state->scrollx);
+            ...
+            tilemap_compositor_draw(state->comp, bitmap, cliprect);
+            draw_sprites(screen->machine, bitmap, cliprect);
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __TILECOMP_H__
+#define __TILECOMP_H__
+
+#include "mamecore.h"
+#include "tilemap.h"
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+/* maximum number of layers in a compositor */
+#define TILEMAP_COMPOSITOR_MAX_LAYERS	8
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+/* opaque reference to a compositor */
+typedef struct _tilemap_compositor tilemap_compositor;
+
+
+
+/***************************************************************************
+    FUNCTION PROTOTYPES
+***************************************************************************/
+
+/* ----- compositor management ----- */
+
+/* allocate a new compositor; must be called at init time */
+tilemap_compositor *tilemap_compositor_alloc(running_machine *machine);
+
+/* set the pen used where no layer covers a pixel */
+void tilemap_compositor_set_background(tilemap_compositor *comp, pen_t pen);
+
+/* forget all cached pixels, e.g. after a change the tilemaps cannot see */
+void tilemap_compositor_invalidate(tilemap_compositor *comp);
+
+
+
+/* ----- layer management ----- */
+
+/* add a layer on top of the existing ones; returns the layer index */
+int tilemap_compositor_add_layer(tilemap_compositor *comp, tilemap *tmap, UINT32 flags, UINT8 priority, UINT8 priority_mask);
+
+/* change the tilemap or draw parameters of an existing layer */
+void tilemap_compositor_set_layer(tilemap_compositor *comp, int layer, tilemap *tmap, UINT32 flags, UINT8 priority, UINT8 priority_mask);
+
+
+
+/* ----- rendering ----- */
+
+/* draw all layers into the cliprect of dest and fill machine->priority_bitmap to match */
+void tilemap_compositor_draw(tilemap_compositor *comp, bitmap_t *dest, const rectangle *cliprect);
+
+
+#endif	/* __TILECOMP_H__ */
@@ -40,6 +40,12 @@
 
 #define MAX_POINTS	10000
 
+/* faded vectors kept from earlier frames for phosphor persistence */
+#define MAX_PERSIST	(MAX_POINTS * 3)
+
+/* anything dimmer than this is gone */
+#define PERSIST_MIN_INTENSITY	(1.0f / 255.0f)
+
 #define VECTOR_TEAM \
 	"-* Vector Heads *-\n" \
 	"Brad Oliver\n" \
@@ -144,10 +150,15 @@ static int flicker;                              /* beam flicker value     */
 static float flicker_correction = 0.0f;
 
 static float beam_width;
+static float persistence;
 
 static point *vector_list;
 static int vector_index;
 
+static render_line_segment *vector_batch;       /* segments handed to the renderer */
+static render_line_segment *persist_list;       /* last frame's segments, for persistence */
+static int persist_count;
+
 
 void vector_set_flicker(float _flicker)
 {
@@ -180,11 +191,22 @@ VIDEO_START( vector )
 
 	/* Grab the settings for this session */
 	vector_set_flicker(options_get_float(mame_options(), OPTION_FLICKER));
+	persistence = options_get_float(mame_options(), OPTION_PERSISTENCE);
+
+	/* at 1.0 or above old vectors would never fade out */
+	if (persistence < 0.0f)
+		persistence = 0.0f;
+	else if (persistence > 0.99f)
+		persistence = 0.99f;
 
 	vector_index = 0;
+	persist_count = 0;
 
 	/* allocate memory for tables */
 	vector_list = auto_alloc_array(machine, point, MAX_POINTS);
+	vector_batch = auto_alloc_array(machine, render_line_segment, MAX_POINTS + MAX_PERSIST);
+	if (persistence > 0.0f)
+		persist_list = auto_alloc_array(machine, render_line_segment, MAX_PERSIST);
 }
 
 
@@ -266,6 +288,7 @@ VIDEO_UPDATE( vector )
 	point *curpoint;
 	render_bounds clip;
 	int lastx = 0, lasty = 0;
+	int count = 0;
 	int i;
 
 	curpoint = vector_list;
@@ -301,15 +324,39 @@ VIDEO_UPDATE( vector )
 
 			if (curpoint->intensity != 0)
 				if (!render_clip_line(&coords, &clip))
-					render_screen_add_line(screen, coords.x0, coords.y0, coords.x1, coords.y1,
-							beam_width * (1.0f / (float)VECTOR_WIDTH_DENOM),
-							(curpoint->intensity << 24) | (curpoint->col & 0xffffff),
-							flags);
+				{
+					render_line_segment *seg = &vector_batch[count++];
+					seg->bounds = coords;
+					seg->color.r = (float)RGB_RED(curpoint->col) * (1.0f / 255.0f);
+					seg->color.g = (float)RGB_GREEN(curpoint->col) * (1.0f / 255.0f);
+					seg->color.b = (float)RGB_BLUE(curpoint->col) * (1.0f / 255.0f);
+					seg->color.a = (float)curpoint->intensity * (1.0f / 255.0f);
+				}
 
 			lastx = curpoint->x;
 			lasty = curpoint->y;
 		}
 		curpoint++;
 	}
+
+	/* fade in what is left of earlier frames; the oldest fall off the end first */
+	if (persist_list != NULL)
+	{
+		for (i = 0; i < persist_count && count < MAX_POINTS + MAX_PERSIST; i++)
+		{
+			render_line_segment *seg = &vector_batch[count];
+			*seg = persist_list[i];
+			seg->color.a *= persistence;
+			if (seg->color.a >= PERSIST_MIN_INTENSITY)
+				count++;
+		}
+
+		/* what we draw now is what fades next frame */
+		persist_count = MIN(count, MAX_PERSIST);
+		memcpy(persist_list, vector_batch, persist_count * sizeof(*persist_list));
+	}
+
+	/* the whole display list goes to the renderer as a single batch */
+	render_screen_add_lines(screen, vector_batch, count, beam_width * (1.0f / (float)VECTOR_WIDTH_DENOM), flags);
 	return 0;
 }
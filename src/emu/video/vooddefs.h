@@ -1604,7 +1604,7 @@ struct _raster_info
 	poly_draw_scanline_func callback;			/* callback pointer */
 	UINT8				is_generic;				/* TRUE if this is one of the generic rasterizers */
 	UINT8				display;				/* display index */
-	UINT32				hits;					/* how many hits (pixels) we've used this for */
+	UINT64				hits;					/* how many hits (pixels) we've used this for */
 	UINT32				polys;					/* how many polys we've used this for */
 	UINT32				eff_color_path;			/* effective fbzColorPath value */
 	UINT32				eff_alpha_mode;			/* effective alphaMode value */
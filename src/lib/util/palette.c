@@ -77,6 +77,7 @@ struct _palette_t
 	float			contrast;					/* overall contrast value */
 	float			gamma;						/* overall gamma value */
 	UINT8			gamma_map[256];				/* gamma map */
+	UINT8			gamma_identity;				/* TRUE if the gamma map changes nothing */
 
 	rgb_t *			entry_color;				/* array of raw colors */
 	float *			entry_contrast;				/* contrast value for each entry */
@@ -86,6 +87,7 @@ struct _palette_t
 	float *			group_bright;				/* brightness value for each group */
 	float *			group_contrast;				/* contrast value for each group */
 
+	dirty_state		pending;					/* changes not yet handed to the clients */
 	palette_client *client_list;				/* list of clients for this palette */
 };
 
@@ -97,6 +99,9 @@ struct _palette_t
 
 static void internal_palette_free(palette_t *palette);
 static void update_adjusted_color(palette_t *palette, UINT32 group, UINT32 index);
+static void update_adjusted_range(palette_t *palette, UINT32 group, UINT32 start, UINT32 end);
+static void mark_dirty(palette_t *palette, UINT32 word, UINT32 bits, UINT32 mindirty, UINT32 maxdirty);
+static void flush_dirty(palette_t *palette);
 
 
 
@@ -119,6 +124,29 @@ INLINE rgb_t adjust_palette_entry(rgb_t entry, float brightness, float contrast,
 }
 
 
+/*-------------------------------------------------
+    compute_adjusted_color - compute the adjusted
+    color for a group and index pair, skipping
+    the arithmetic when no adjustment is active
+-------------------------------------------------*/
+
+INLINE rgb_t compute_adjusted_color(palette_t *palette, UINT32 group, UINT32 index)
+{
+	rgb_t entry = palette->entry_color[index];
+	float brightness = palette->group_bright[group] + palette->brightness;
+	float contrast = palette->group_contrast[group] * palette->entry_contrast[index] * palette->contrast;
+
+	/* with no brightness or contrast, only the gamma map applies */
+	if (brightness == 0.0f && contrast == 1.0f)
+	{
+		if (palette->gamma_identity)
+			return entry;
+		return MAKE_ARGB(RGB_ALPHA(entry), palette->gamma_map[RGB_RED(entry)], palette->gamma_map[RGB_GREEN(entry)], palette->gamma_map[RGB_BLUE(entry)]);
+	}
+	return adjust_palette_entry(entry, brightness, contrast, palette->gamma_map);
+}
+
+
 
 /***************************************************************************
     PALETTE ALLOCATION
@@ -146,6 +174,7 @@ palette_t *palette_alloc(UINT32 numcolors, UINT32 numgroups)
 	palette->gamma = 1.0f;
 	for (index = 0; index < 256; index++)
 		palette->gamma_map[index] = index;
+	palette->gamma_identity = TRUE;
 
 	/* allocate an array of palette entries and individual contrasts for each */
 	palette->entry_color = (rgb_t *)malloc(sizeof(*palette->entry_color) * numcolors);
@@ -192,6 +221,14 @@ palette_t *palette_alloc(UINT32 numcolors, UINT32 numgroups)
 	palette->adjusted_color[index] = RGB_WHITE;
 	palette->adjusted_rgb15[index++] = rgb_to_rgb15(RGB_WHITE);
 
+	/* allocate the pending dirty list; clients start out all dirty anyway */
+	palette->pending.dirty = (UINT32 *)malloc(((numcolors * numgroups + 31) / 32) * sizeof(UINT32));
+	if (palette->pending.dirty == NULL)
+		goto error;
+	memset(palette->pending.dirty, 0, ((numcolors * numgroups + 31) / 32) * sizeof(UINT32));
+	palette->pending.mindirty = numcolors * numgroups;
+	palette->pending.maxdirty = 0;
+
 	/* initialize the remainder of the structure */
 	palette->refcount = 1;
 	palette->numcolors = numcolors;
@@ -398,6 +435,9 @@ const UINT32 *palette_client_get_dirty_list(palette_client *client, UINT32 *mind
 {
 	dirty_state temp;
 
+	/* hand over any changes made since the last call */
+	flush_dirty(client->palette);
+
 	/* fill in the mindirty/maxdirty */
 	if (mindirty != NULL)
 		*mindirty = client->live.mindirty;
@@ -415,7 +455,7 @@ const UINT32 *palette_client_get_dirty_list(palette_client *client, UINT32 *mind
 
 	/* erase relevant entries in the new live one */
 	if (client->live.mindirty <= client->live.maxdirty)
-		memset(client->live.dirty, client->live.mindirty / 8, (client->live.maxdirty / 8) + 1 - (client->live.mindirty / 8));
+		memset(&client->live.dirty[client->live.mindirty / 32], 0, ((client->live.maxdirty / 32) + 1 - (client->live.mindirty / 32)) * sizeof(UINT32));
 	client->live.mindirty = client->palette->numcolors * client->palette->numgroups;
 	client->live.maxdirty = 0;
 
@@ -451,6 +491,37 @@ void palette_entry_set_color(palette_t *palette, UINT32 index, rgb_t rgb)
 }
 
 
+/*-------------------------------------------------
+    palette_entry_set_colors - set the raw RGB
+    colors for a block of palette indexes
+-------------------------------------------------*/
+
+void palette_entry_set_colors(palette_t *palette, UINT32 index, const rgb_t *colors, UINT32 count)
+{
+	UINT32 first = ~0, last = 0;
+	int groupnum;
+
+	/* clip to the palette */
+	if (index >= palette->numcolors)
+		return;
+	count = MIN(count, palette->numcolors - index);
+
+	/* set the colors, noting the range that changed */
+	for ( ; count > 0; count--, index++, colors++)
+		if (palette->entry_color[index] != *colors)
+		{
+			palette->entry_color[index] = *colors;
+			first = MIN(first, index);
+			last = index;
+		}
+
+	/* update across all groups in one pass per group */
+	if (first <= last)
+		for (groupnum = 0; groupnum < palette->numgroups; groupnum++)
+			update_adjusted_range(palette, groupnum, first, last);
+}
+
+
 /*-------------------------------------------------
     palette_entry_get_color - return the raw RGB
     color for a given palette index
@@ -521,7 +592,7 @@ const rgb_t *palette_entry_list_adjusted_rgb15(palette_t *palette)
 
 void palette_set_brightness(palette_t *palette, float brightness)
 {
-	int groupnum, index;
+	int groupnum;
 
 	/* convert incoming value to normalized result */
 	brightness = (brightness - 1.0f) * 256.0f;
@@ -533,8 +604,7 @@ void palette_set_brightness(palette_t *palette, float brightness)
 
 	/* update across all indices in all groups */
 	for (groupnum = 0; groupnum < palette->numgroups; groupnum++)
-		for (index = 0; index < palette->numcolors; index++)
-			update_adjusted_color(palette, groupnum, index);
+		update_adjusted_range(palette, groupnum, 0, palette->numcolors - 1);
 }
 
 
@@ -545,7 +615,7 @@ void palette_set_brightness(palette_t *palette, float brightness)
 
 void palette_set_contrast(palette_t *palette, float contrast)
 {
-	int groupnum, index;
+	int groupnum;
 
 	/* set the global contrast if changed */
 	if (palette->contrast == contrast)
@@ -554,8 +624,7 @@ void palette_set_contrast(palette_t *palette, float contrast)
 
 	/* update across all indices in all groups */
 	for (groupnum = 0; groupnum < palette->numgroups; groupnum++)
-		for (index = 0; index < palette->numcolors; index++)
-			update_adjusted_color(palette, groupnum, index);
+		update_adjusted_range(palette, groupnum, 0, palette->numcolors - 1);
 }
 
 
@@ -582,10 +651,15 @@ void palette_set_gamma(palette_t *palette, float gamma)
 		palette->gamma_map[index] = rgb_clamp(255.0f * fresult);
 	}
 
+	/* note whether the map changes anything */
+	palette->gamma_identity = TRUE;
+	for (index = 0; index < 256; index++)
+		if (palette->gamma_map[index] != index)
+			palette->gamma_identity = FALSE;
+
 	/* update across all indices in all groups */
 	for (groupnum = 0; groupnum < palette->numgroups; groupnum++)
-		for (index = 0; index < palette->numcolors; index++)
-			update_adjusted_color(palette, groupnum, index);
+		update_adjusted_range(palette, groupnum, 0, palette->numcolors - 1);
 }
 
 
@@ -629,8 +703,6 @@ float palette_entry_get_contrast(palette_t *palette, UINT32 index)
 
 void palette_group_set_brightness(palette_t *palette, UINT32 group, float brightness)
 {
-	int index;
-
 	/* convert incoming value to normalized result */
 	brightness = (brightness - 1.0f) * 256.0f;
 
@@ -642,8 +714,7 @@ void palette_group_set_brightness(palette_t *palette, UINT32 group, float bright
 	palette->group_bright[group] = brightness;
 
 	/* update across all colors */
-	for (index = 0; index < palette->numcolors; index++)
-		update_adjusted_color(palette, group, index);
+	update_adjusted_range(palette, group, 0, palette->numcolors - 1);
 }
 
 
@@ -654,8 +725,6 @@ void palette_group_set_brightness(palette_t *palette, UINT32 group, float bright
 
 void palette_group_set_contrast(palette_t *palette, UINT32 group, float contrast)
 {
-	int index;
-
 	/* if out of range, or unchanged, ignore */
 	if (group >= palette->numgroups || palette->group_contrast[group] == contrast)
 		return;
@@ -664,8 +733,7 @@ void palette_group_set_contrast(palette_t *palette, UINT32 group, float contrast
 	palette->group_contrast[group] = contrast;
 
 	/* update across all colors */
-	for (index = 0; index < palette->numcolors; index++)
-		update_adjusted_color(palette, group, index);
+	update_adjusted_range(palette, group, 0, palette->numcolors - 1);
 }
 
 
@@ -745,6 +813,8 @@ static void internal_palette_free(palette_t *palette)
 		free(palette->adjusted_color);
 	if (palette->adjusted_rgb15 != NULL)
 		free(palette->adjusted_rgb15);
+	if (palette->pending.dirty != NULL)
+		free(palette->pending.dirty);
 
 	/* and the palette itself */
 	free(palette);
@@ -759,14 +829,10 @@ static void internal_palette_free(palette_t *palette)
 static void update_adjusted_color(palette_t *palette, UINT32 group, UINT32 index)
 {
 	UINT32 finalindex = group * palette->numcolors + index;
-	palette_client *client;
 	rgb_t adjusted;
 
 	/* compute the adjusted value */
-	adjusted = adjust_palette_entry(palette->entry_color[index],
-				palette->group_bright[group] + palette->brightness,
-				palette->group_contrast[group] * palette->entry_contrast[index] * palette->contrast,
-				palette->gamma_map);
+	adjusted = compute_adjusted_color(palette, group, index);
 
 	/* if not different, ignore */
 	if (palette->adjusted_color[finalindex] == adjusted)
@@ -777,10 +843,98 @@ static void update_adjusted_color(palette_t *palette, UINT32 group, UINT32 index
 	palette->adjusted_rgb15[finalindex] = rgb_to_rgb15(adjusted);
 
 	/* mark dirty in all clients */
+	mark_dirty(palette, finalindex / 32, 1 << (finalindex % 32), finalindex, finalindex);
+}
+
+
+/*-------------------------------------------------
+    update_adjusted_range - update a range of
+    color indexes within a group, marking the
+    clients dirty a word at a time
+-------------------------------------------------*/
+
+static void update_adjusted_range(palette_t *palette, UINT32 group, UINT32 start, UINT32 end)
+{
+	UINT32 base = group * palette->numcolors;
+	UINT32 mindirty = ~0, maxdirty = 0;
+	UINT32 word = (base + start) / 32;
+	UINT32 bits = 0;
+	UINT32 index;
+
+	for (index = start; index <= end; index++)
+	{
+		UINT32 finalindex = base + index;
+		rgb_t adjusted = compute_adjusted_color(palette, group, index);
+
+		/* flush the dirty bits when we cross into a new word */
+		if (finalindex / 32 != word)
+		{
+			if (bits != 0)
+				mark_dirty(palette, word, bits, mindirty, maxdirty);
+			word = finalindex / 32;
+			bits = 0;
+		}
+
+		/* if not different, ignore */
+		if (palette->adjusted_color[finalindex] == adjusted)
+			continue;
+
+		/* otherwise, modify the adjusted color array */
+		palette->adjusted_color[finalindex] = adjusted;
+		palette->adjusted_rgb15[finalindex] = rgb_to_rgb15(adjusted);
+		bits |= 1 << (finalindex % 32);
+		mindirty = MIN(mindirty, finalindex);
+		maxdirty = finalindex;
+	}
+
+	/* flush the final word */
+	if (bits != 0)
+		mark_dirty(palette, word, bits, mindirty, maxdirty);
+}
+
+
+/*-------------------------------------------------
+    mark_dirty - mark a set of entries within a
+    single word of the dirty bitmap as changed;
+    the clients pick them up in flush_dirty
+-------------------------------------------------*/
+
+static void mark_dirty(palette_t *palette, UINT32 word, UINT32 bits, UINT32 mindirty, UINT32 maxdirty)
+{
+	palette->pending.dirty[word] |= bits;
+	palette->pending.mindirty = MIN(palette->pending.mindirty, mindirty);
+	palette->pending.maxdirty = MAX(palette->pending.maxdirty, maxdirty);
+}
+
+
+/*-------------------------------------------------
+    flush_dirty - hand the entries changed since
+    the last flush to all clients, a word at a
+    time
+-------------------------------------------------*/
+
+static void flush_dirty(palette_t *palette)
+{
+	dirty_state *pending = &palette->pending;
+	palette_client *client;
+	UINT32 minword, maxword, word;
+
+	/* nothing to do if nothing changed */
+	if (pending->mindirty > pending->maxdirty)
+		return;
+	minword = pending->mindirty / 32;
+	maxword = pending->maxdirty / 32;
+
 	for (client = palette->client_list; client != NULL; client = client->next)
 	{
-		client->live.dirty[finalindex / 32] |= 1 << (finalindex % 32);
-		client->live.mindirty = MIN(client->live.mindirty, finalindex);
-		client->live.maxdirty = MAX(client->live.maxdirty, finalindex);
+		for (word = minword; word <= maxword; word++)
+			client->live.dirty[word] |= pending->dirty[word];
+		client->live.mindirty = MIN(client->live.mindirty, pending->mindirty);
+		client->live.maxdirty = MAX(client->live.maxdirty, pending->maxdirty);
 	}
+
+	/* start over */
+	memset(&pending->dirty[minword], 0, (maxword + 1 - minword) * sizeof(UINT32));
+	pending->mindirty = palette->numcolors * palette->numgroups;
+	pending->maxdirty = 0;
 }
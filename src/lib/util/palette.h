@@ -141,6 +141,9 @@ const UINT32 *palette_client_get_dirty_list(palette_client *client, UINT32 *mind
 /* set the raw RGB color for a given palette index */
 void palette_entry_set_color(palette_t *palette, UINT32 index, rgb_t rgb);
 
+/* set the raw RGB colors for a block of palette indexes */
+void palette_entry_set_colors(palette_t *palette, UINT32 index, const rgb_t *colors, UINT32 count);
+
 /* return the raw RGB color for a given palette index */
 rgb_t palette_entry_get_color(palette_t *palette, UINT32 index);
 
@@ -589,7 +589,9 @@ static const tms34010_config tms_config =
 	midtunit_scanline_update,		/* scanline updater */
 	NULL,							/* generate interrupt */
 	midtunit_to_shiftreg,			/* write to shiftreg function */
-	midtunit_from_shiftreg			/* read from shiftreg function */
+	midtunit_from_shiftreg,			/* read from shiftreg function */
+	midtunit_vram_read_row,			/* bulk VRAM read for PIXBLT/FILL */
+	midtunit_vram_write_row			/* bulk VRAM write for PIXBLT/FILL */
 };
 
 
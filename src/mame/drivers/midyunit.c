@@ -991,7 +991,9 @@ static const tms34010_config zunit_tms_config =
 	midyunit_scanline_update,		/* scanline updater */
 	NULL,							/* generate interrupt */
 	midyunit_to_shiftreg,			/* write to shiftreg function */
-	midyunit_from_shiftreg			/* read from shiftreg function */
+	midyunit_from_shiftreg,			/* read from shiftreg function */
+	midyunit_vram_read_row,			/* bulk VRAM read for PIXBLT/FILL */
+	midyunit_vram_write_row			/* bulk VRAM write for PIXBLT/FILL */
 };
 
 static const tms34010_config yunit_tms_config =
@@ -1003,7 +1005,9 @@ static const tms34010_config yunit_tms_config =
 	midyunit_scanline_update,		/* scanline updater */
 	NULL,							/* generate interrupt */
 	midyunit_to_shiftreg,			/* write to shiftreg function */
-	midyunit_from_shiftreg			/* read from shiftreg function */
+	midyunit_from_shiftreg,			/* read from shiftreg function */
+	midyunit_vram_read_row,			/* bulk VRAM read for PIXBLT/FILL */
+	midyunit_vram_write_row			/* bulk VRAM write for PIXBLT/FILL */
 };
 
 
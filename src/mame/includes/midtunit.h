@@ -49,6 +49,8 @@ READ16_HANDLER( midtunit_vram_color_r );
 
 void midtunit_to_shiftreg(const address_space *space, UINT32 address, UINT16 *shiftreg);
 void midtunit_from_shiftreg(const address_space *space, UINT32 address, UINT16 *shiftreg);
+int midtunit_vram_read_row(const address_space *space, offs_t address, UINT16 *dest, UINT32 count);
+void midtunit_vram_write_row(const address_space *space, offs_t address, const UINT16 *src, UINT32 count);
 
 WRITE16_HANDLER( midtunit_control_w );
 WRITE16_HANDLER( midwunit_control_w );
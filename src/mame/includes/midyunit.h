@@ -55,6 +55,8 @@ READ16_HANDLER( midyunit_vram_r );
 
 void midyunit_to_shiftreg(const address_space *space, UINT32 address, UINT16 *shiftreg);
 void midyunit_from_shiftreg(const address_space *space, UINT32 address, UINT16 *shiftreg);
+int midyunit_vram_read_row(const address_space *space, offs_t address, UINT16 *dest, UINT32 count);
+void midyunit_vram_write_row(const address_space *space, offs_t address, const UINT16 *src, UINT32 count);
 
 WRITE16_HANDLER( midyunit_control_w );
 WRITE16_HANDLER( midyunit_paletteram_w );
@@ -76,6 +76,13 @@ VIDEO_START( finalizr )
 {
 	bg_tilemap = tilemap_create(machine, get_bg_tile_info, tilemap_scan_rows,  8, 8, 32, 32);
 	fg_tilemap = tilemap_create(machine, get_fg_tile_info, tilemap_scan_rows,  8, 8, 32, 32);
+
+	/* the tile RAM is plain RAM, so let the tilemaps find the changed tiles themselves */
+	tilemap_bind_memory(bg_tilemap, videoram, 1);
+	tilemap_bind_memory(bg_tilemap, colorram, 1);
+	tilemap_bind_dependency(bg_tilemap, &charbank, sizeof(charbank));
+	tilemap_bind_memory(fg_tilemap, finalizr_videoram2, 1);
+	tilemap_bind_memory(fg_tilemap, finalizr_colorram2, 1);
 }
 
 
@@ -95,9 +102,6 @@ VIDEO_UPDATE( finalizr )
 {
 	int offs;
 
-	tilemap_mark_all_tiles_dirty(bg_tilemap);
-	tilemap_mark_all_tiles_dirty(fg_tilemap);
-
 	tilemap_set_scrollx(bg_tilemap, 0, *finalizr_scroll-16);
 	tilemap_draw(bitmap, cliprect, bg_tilemap, 0, 0);
 
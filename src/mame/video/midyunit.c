@@ -213,6 +213,51 @@ void midyunit_from_shiftreg(const address_space *space, UINT32 address, UINT16 *
 
 
 
+/*************************************
+ *
+ *  Bulk VRAM access for PIXBLT/FILL
+ *
+ *************************************/
+
+int midyunit_vram_read_row(const address_space *space, offs_t address, UINT16 *dest, UINT32 count)
+{
+	/* only the VRAM region at the bottom of the map */
+	if (address >= 0x40000 || count > (0x40000 - address) / 2)
+		return FALSE;
+
+	/* same layout as midyunit_vram_r */
+	if (videobank_select)
+		for ( ; count > 0; count--, address += 2)
+			*dest++ = (local_videoram[address] & 0x00ff) | (local_videoram[address + 1] << 8);
+	else
+		for ( ; count > 0; count--, address += 2)
+			*dest++ = (local_videoram[address] >> 8) | (local_videoram[address + 1] & 0xff00);
+	return TRUE;
+}
+
+
+void midyunit_vram_write_row(const address_space *space, offs_t address, const UINT16 *src, UINT32 count)
+{
+	/* same layout as midyunit_vram_w */
+	if (videobank_select)
+	{
+		UINT16 palette = dma_register[DMA_PALETTE];
+		for ( ; count > 0; count--, address += 2, src++)
+		{
+			local_videoram[address] = (*src & 0x00ff) | (palette << 8);
+			local_videoram[address + 1] = (*src >> 8) | (palette & 0xff00);
+		}
+	}
+	else
+		for ( ; count > 0; count--, address += 2, src++)
+		{
+			local_videoram[address] = (local_videoram[address] & 0x00ff) | (*src << 8);
+			local_videoram[address + 1] = (local_videoram[address + 1] & 0x00ff) | (*src & 0xff00);
+		}
+}
+
+
+
 /*************************************
  *
  *  Y/Z-unit control register
@@ -2220,6 +2220,8 @@ static VIDEO_START( common )
 	mbDSPisActive = 0;
 	memset( namcos22_polygonram, 0xcc, 0x20000 );
 
+	/* the texture mapper reads the decoded tiles as one block */
+	gfx_element_disable_cache(machine->gfx[GFX_TEXTURE_TILE]);
 	for (code = 0; code < machine->gfx[GFX_TEXTURE_TILE]->total_elements; code++)
 		gfx_element_decode(machine->gfx[GFX_TEXTURE_TILE], code);
 	Prepare3dTexture(machine, memory_region(machine, "textilemap"), machine->gfx[GFX_TEXTURE_TILE]->gfxdata );
@@ -8,6 +8,7 @@
 */
 
 #include "driver.h"
+#include "video/spritelist.h"
 #include "includes/nmk16.h"
 
 // the larger tilemaps on macross2, rapid hero and thunder dragon 2 appear to act like 4 'banks'
@@ -29,6 +30,10 @@ UINT16 *afega_scroll_1;
 static int redraw_bitmap;
 
 static UINT16 *spriteram_old,*spriteram_old2;
+static sprite_list *sprite_lists[4];	/* spriteram_old2 decoded, one list per priority */
+static int sprite_lists_valid;
+static int sprite_lists_flip;
+static int sprite_lists_flipsupported;
 static int bgbank;
 static int videoshift;
 static int bioship_background_bank;
@@ -118,10 +123,20 @@ static TILE_GET_INFO( get_tile_info_0_8bit )
 
 ***************************************************************************/
 
+static void nmk16_sprite_lists_init(running_machine *machine)
+{
+	int pri;
+
+	for (pri = 0; pri < 4; pri++)
+		sprite_lists[pri] = sprite_list_alloc(machine, 0x1000/16);
+	sprite_lists_valid = FALSE;
+}
+
 static void nmk16_video_init(running_machine *machine)
 {
 	spriteram_old = auto_alloc_array_clear(machine, UINT16, 0x1000/2);
 	spriteram_old2 = auto_alloc_array_clear(machine, UINT16, 0x1000/2);
+	nmk16_sprite_lists_init(machine);
 
 	videoshift = 0;		/* 256x224 screen, no shift */
 	background_bitmap = NULL;
@@ -385,7 +400,7 @@ WRITE16_HANDLER( bioship_bank_w )
 
 // manybloc uses extra flip bits on the sprites, but these break other games
 
-static void nmk16_draw_sprites(running_machine *machine, bitmap_t *bitmap, const rectangle *cliprect, int priority)
+static void nmk16_build_sprites(running_machine *machine)
 {
 	int offs;
 
@@ -403,9 +418,6 @@ static void nmk16_draw_sprites(running_machine *machine, bitmap_t *bitmap, const
 			int xx,yy,x;
 			int delta = 16;
 
-			if(pri != priority)
-				continue;
-
 			if (flip_screen_get(machine))
 			{
 				sx = 368 - sx;
@@ -420,11 +432,11 @@ static void nmk16_draw_sprites(running_machine *machine, bitmap_t *bitmap, const
 				xx = w;
 				do
 				{
-					drawgfx_transpen(bitmap,cliprect,machine->gfx[2],
+					sprite_list_add(sprite_lists[pri],machine->gfx[2],
 							code,
 							color,
 							flip_screen_get(machine), flip_screen_get(machine),
-							((x + 16) & 0x1ff) - 16,sy & 0x1ff,15);
+							((x + 16) & 0x1ff) - 16,sy & 0x1ff,0x10000,0x10000,15);
 					code++;
 					x += delta;
 				} while (--xx >= 0);
@@ -435,7 +447,7 @@ static void nmk16_draw_sprites(running_machine *machine, bitmap_t *bitmap, const
 	}
 }
 
-static void nmk16_draw_sprites_flipsupported(running_machine *machine, bitmap_t *bitmap, const rectangle *cliprect, int priority)
+static void nmk16_build_sprites_flipsupported(running_machine *machine)
 {
 	int offs;
 
@@ -456,9 +468,6 @@ static void nmk16_draw_sprites_flipsupported(running_machine *machine, bitmap_t
 			int xx,yy,x;
 			int delta = 16;
 
-			if(pri != priority)
-				continue;
-
 			flipx ^= flip_screen_get(machine);
 			flipy ^= flip_screen_get(machine);
 
@@ -479,11 +488,11 @@ static void nmk16_draw_sprites_flipsupported(running_machine *machine, bitmap_t
 				xx = w;
 				do
 				{
-					drawgfx_transpen(bitmap,cliprect,machine->gfx[2],
+					sprite_list_add(sprite_lists[pri],machine->gfx[2],
 							code,
 							color,
 							flipx, flipy,
-							((x + 16) & 0x1ff) - 16,sy & 0x1ff,15);
+							((x + 16) & 0x1ff) - 16,sy & 0x1ff,0x10000,0x10000,15);
 
 					code++;
 					x +=delta * ( flipx?-1:1 );
@@ -497,6 +506,40 @@ static void nmk16_draw_sprites_flipsupported(running_machine *machine, bitmap_t
 	}
 }
 
+/* the sprite table only changes at VBLANK, so it is decoded once into the
+   per-priority lists and each update just draws the sprites in its cliprect */
+static void nmk16_update_sprite_lists(running_machine *machine, int flipsupported)
+{
+	int pri;
+
+	if (sprite_lists_valid && sprite_lists_flip == flip_screen_get(machine) && sprite_lists_flipsupported == flipsupported)
+		return;
+
+	for (pri = 0; pri < 4; pri++)
+		sprite_list_reset(sprite_lists[pri]);
+	if (flipsupported)
+		nmk16_build_sprites_flipsupported(machine);
+	else
+		nmk16_build_sprites(machine);
+
+	sprite_lists_valid = TRUE;
+	sprite_lists_flip = flip_screen_get(machine);
+	sprite_lists_flipsupported = flipsupported;
+}
+
+static void nmk16_draw_sprites(running_machine *machine, bitmap_t *bitmap, const rectangle *cliprect, int priority)
+{
+	nmk16_update_sprite_lists(machine, FALSE);
+	sprite_list_draw(sprite_lists[priority], bitmap, cliprect);
+}
+
+static void nmk16_draw_sprites_flipsupported(running_machine *machine, bitmap_t *bitmap, const rectangle *cliprect, int priority)
+{
+	nmk16_update_sprite_lists(machine, TRUE);
+	sprite_list_draw(sprite_lists[priority], bitmap, cliprect);
+}
+
+
 
 VIDEO_UPDATE( macross )
 {
@@ -750,6 +793,7 @@ VIDEO_EOF( nmk )
 
 //  memcpy(spriteram_old2,spriteram_old,0x1000);
 	memcpy(spriteram_old2,nmk16_mainram+0x8000/2,0x1000);
+	sprite_lists_valid = FALSE;
 }
 
 VIDEO_EOF( strahl )
@@ -763,6 +807,7 @@ VIDEO_EOF( strahl )
 	/* strahl sprites are allocated in memory range FF000-FFFFF */
 
 	memcpy(spriteram_old2,nmk16_mainram+0xF000/2,0x1000);
+	sprite_lists_valid = FALSE;
 }
 
 
@@ -779,6 +824,7 @@ VIDEO_START( afega )
 {
 	spriteram_old = auto_alloc_array_clear(machine, UINT16, 0x1000/2);
 	spriteram_old2 = auto_alloc_array_clear(machine, UINT16, 0x1000/2);
+	nmk16_sprite_lists_init(machine);
 
 	bg_tilemap0 = tilemap_create(	machine, macross_get_bg0_tile_info, afega_tilemap_scan_pages,
 
@@ -798,6 +844,7 @@ VIDEO_START( grdnstrm )
 {
 	spriteram_old = auto_alloc_array_clear(machine, UINT16, 0x1000/2);
 	spriteram_old2 = auto_alloc_array_clear(machine, UINT16, 0x1000/2);
+	nmk16_sprite_lists_init(machine);
 
 
 	bg_tilemap0 = tilemap_create(	machine, get_tile_info_0_8bit, afega_tilemap_scan_pages,
@@ -818,6 +865,7 @@ VIDEO_START( firehawk )
 {
 	spriteram_old = auto_alloc_array_clear(machine, UINT16, 0x1000/2);
 	spriteram_old2 = auto_alloc_array_clear(machine, UINT16, 0x1000/2);
+	nmk16_sprite_lists_init(machine);
 
 
 	bg_tilemap0 = tilemap_create(	machine, get_tile_info_0_8bit, afega_tilemap_scan_pages,
@@ -1,4 +1,5 @@
 #include "driver.h"
+#include "video/tilecomp.h"
 
 /* Sprites probably need to be delayed */
 /* Some scroll layers may need to be offset slightly? */
@@ -7,6 +8,7 @@
 /* is theres a bg colour register? */
 
 static tilemap *fg_tilemap,*fg2_tilemap,*fg3_tilemap;
+static tilemap_compositor *compositor;
 extern UINT32 *silkroad_vidram,*silkroad_vidram2,*silkroad_vidram3, *silkroad_sprram, *silkroad_regs;
 
 static void draw_sprites(running_machine *machine, bitmap_t *bitmap, const rectangle *cliprect)
@@ -128,13 +130,17 @@ VIDEO_START(silkroad)
 	tilemap_set_transparent_pen(fg_tilemap,0);
 	tilemap_set_transparent_pen(fg2_tilemap,0);
 	tilemap_set_transparent_pen(fg3_tilemap,0);
+
+	/* the layers only change when scrolled or written, so keep them composited */
+	compositor = tilemap_compositor_alloc(machine);
+	tilemap_compositor_set_background(compositor, 0x7c0);
+	tilemap_compositor_add_layer(compositor, fg_tilemap, 0, 0, 0xff);
+	tilemap_compositor_add_layer(compositor, fg2_tilemap, 0, 1, 0xff);
+	tilemap_compositor_add_layer(compositor, fg3_tilemap, 0, 2, 0xff);
 }
 
 VIDEO_UPDATE(silkroad)
 {
-	bitmap_fill(screen->machine->priority_bitmap,cliprect,0);
-	bitmap_fill(bitmap,cliprect,0x7c0);
-
 	tilemap_set_scrollx( fg_tilemap, 0, ((silkroad_regs[0] & 0xffff0000) >> 16) );
 	tilemap_set_scrolly( fg_tilemap, 0, (silkroad_regs[0] & 0x0000ffff) >> 0 );
 
@@ -144,9 +150,8 @@ VIDEO_UPDATE(silkroad)
 	tilemap_set_scrolly( fg2_tilemap, 0, ((silkroad_regs[5] & 0xffff0000) >> 16));
 	tilemap_set_scrollx( fg2_tilemap, 0, (silkroad_regs[2] & 0x0000ffff) >> 0 );
 
-	tilemap_draw(bitmap,cliprect,fg_tilemap, 0,0);
-	tilemap_draw(bitmap,cliprect,fg2_tilemap,0,1);
-	tilemap_draw(bitmap,cliprect,fg3_tilemap,0,2);
+	/* fills the background and the priority bitmap just as the three tilemap_draw calls did */
+	tilemap_compositor_draw(compositor,bitmap,cliprect);
 	draw_sprites(screen->machine,bitmap,cliprect);
 
 /*
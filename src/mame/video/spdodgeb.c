@@ -5,8 +5,17 @@
 
 UINT8 *spdodgeb_videoram;
 
-static int tile_palbank;
-static int sprite_palbank;
+/* everything the display depends on that changes mid-frame; partial updates record a copy */
+typedef struct _raster_state raster_state;
+struct _raster_state
+{
+	int scroll;
+	int tile_palbank;
+	int sprite_palbank;
+};
+
+static raster_state raster;
+static int bg_palbank;
 
 static tilemap *bg_tilemap;
 
@@ -66,7 +75,7 @@ static TILE_GET_INFO( get_bg_tile_info )
 	SET_TILE_INFO(
 			0,
 			code + ((attr & 0x1f) << 8),
-			((attr & 0xe0) >> 5) + 8 * tile_palbank,
+			((attr & 0xe0) >> 5) + 8 * bg_palbank,
 			0);
 }
 
@@ -80,6 +89,9 @@ static TILE_GET_INFO( get_bg_tile_info )
 VIDEO_START( spdodgeb )
 {
 	bg_tilemap = tilemap_create(machine, get_bg_tile_info,background_scan,8,8,64,32);
+
+	/* the game changes the scroll every 8 scanlines; record it and draw the frame in one go */
+	video_screen_register_partial_state(machine->primary_screen, &raster, sizeof(raster));
 }
 
 
@@ -89,8 +101,6 @@ VIDEO_START( spdodgeb )
 
 ***************************************************************************/
 
-static int lastscroll;
-
 INTERRUPT_GEN( spdodgeb_interrupt )
 {
 	int iloop = cpu_getiloops(device);
@@ -110,7 +120,7 @@ INTERRUPT_GEN( spdodgeb_interrupt )
 
 WRITE8_HANDLER( spdodgeb_scrollx_lo_w )
 {
-	lastscroll = (lastscroll & 0x100) | data;
+	raster.scroll = (raster.scroll & 0x100) | data;
 }
 
 WRITE8_HANDLER( spdodgeb_ctrl_w )
@@ -124,17 +134,13 @@ WRITE8_HANDLER( spdodgeb_ctrl_w )
 	memory_set_bankptr(space->machine, 1,rom + 0x10000 + 0x4000 * ((~data & 0x02) >> 1));
 
 	/* bit 2 = scroll high bit */
-	lastscroll = (lastscroll & 0x0ff) | ((data & 0x04) << 6);
+	raster.scroll = (raster.scroll & 0x0ff) | ((data & 0x04) << 6);
 
 	/* bit 3 = to mcu?? */
 
-	/* bits 4-7 = palette bank select */
-	if (tile_palbank != ((data & 0x30) >> 4))
-	{
-		tile_palbank = ((data & 0x30) >> 4);
-		tilemap_mark_all_tiles_dirty(bg_tilemap);
-	}
-	sprite_palbank = (data & 0xc0) >> 6;
+	/* bits 4-7 = palette bank select; the tiles are redrawn when a band needs a new bank */
+	raster.tile_palbank = (data & 0x30) >> 4;
+	raster.sprite_palbank = (data & 0xc0) >> 6;
 }
 
 WRITE8_HANDLER( spdodgeb_videoram_w )
@@ -153,9 +159,9 @@ WRITE8_HANDLER( spdodgeb_videoram_w )
 
 #define DRAW_SPRITE( order, sx, sy ) drawgfx_transpen( bitmap, \
 					cliprect,gfx, \
-					(which+order),color+ 8 * sprite_palbank,flipx,flipy,sx,sy,0);
+					(which+order),color+ 8 * palbank,flipx,flipy,sx,sy,0);
 
-static void draw_sprites(running_machine *machine, bitmap_t *bitmap, const rectangle *cliprect )
+static void draw_sprites(running_machine *machine, bitmap_t *bitmap, const rectangle *cliprect, int palbank )
 {
 	const gfx_element *gfx = machine->gfx[1];
 	UINT8 *src;
@@ -213,8 +219,25 @@ static void draw_sprites(running_machine *machine, bitmap_t *bitmap, const recta
 
 VIDEO_UPDATE( spdodgeb )
 {
-	tilemap_set_scrollx(bg_tilemap,0,lastscroll+5);
-	tilemap_draw(bitmap,cliprect,bg_tilemap,0,0);
-	draw_sprites(screen->machine, bitmap,cliprect);
+	rectangle band = *cliprect;
+
+	/* draw each run of scanlines with the scroll and palette banks recorded for it */
+	for (band.min_y = cliprect->min_y; band.min_y <= cliprect->max_y; band.min_y = band.max_y + 1)
+	{
+		const raster_state *state = (const raster_state *)video_screen_get_partial_state(screen, 0, band.min_y, &band.max_y);
+
+		if (band.max_y > cliprect->max_y)
+			band.max_y = cliprect->max_y;
+
+		if (bg_palbank != state->tile_palbank)
+		{
+			bg_palbank = state->tile_palbank;
+			tilemap_mark_all_tiles_dirty(bg_tilemap);
+		}
+
+		tilemap_set_scrollx(bg_tilemap,0,state->scroll+5);
+		tilemap_draw(bitmap,&band,bg_tilemap,0,0);
+		draw_sprites(screen->machine, bitmap,&band,state->sprite_palbank);
+	}
 	return 0;
 }
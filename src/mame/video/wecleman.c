@@ -978,7 +978,13 @@ VIDEO_START( wecleman )
 	tilemap_set_scrollx(txt_tilemap, 0, 512-320-16 -BMP_PAD);
 	tilemap_set_scrolly(txt_tilemap, 0, -BMP_PAD );
 
+	// the road reads its 8 consecutive codes as one run, and the patch below writes gfxdata
+	gfx_element_disable_cache(machine->gfx[0]);
+	gfx_element_disable_cache(machine->gfx[1]);
+
 	// patches out a mysterious pixel floating in the sky (tile decoding bug?)
+	// decode the tile first so a later on-demand decode does not undo the patch
+	gfx_element_get_data(machine->gfx[0], 0xaca);
 	*(machine->gfx[0]->gfxdata + (machine->gfx[0]->char_modulo*0xaca+7)) = 0;
 }
 
@@ -43,6 +43,7 @@
 #include "render.h"
 #include "clifront.h"
 #include "mame.h"
+#include "osdmini.h"
 
 
 //============================================================
@@ -78,12 +79,25 @@ static input_device *keyboard_device;
 // the state of each key
 static UINT8 keyboard_state[KEY_TOTAL];
 
+// our own 32bpp frame, used when the screen can't be handed out as-is
+static UINT32 *frame_buffer;
+static int frame_buffer_size;
+
+// work queue for rendering into our own frame in bands
+static osd_work_queue *render_queue;
+
+// the most recent frame, which may point directly at a screen bitmap
+static const UINT32 *frame_base;
+static int frame_width, frame_height, frame_rowpixels;
+
 
 //============================================================
 //  FUNCTION PROTOTYPES
 //============================================================
 
+static void mini_exit(running_machine *machine);
 static INT32 keyboard_get_state(void *device_internal, void *item_internal);
+static void mini_rgb888_draw_primitives(const render_primitive *primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, osd_work_queue *queue);
 
 
 //============================================================
@@ -109,6 +123,10 @@ void osd_init(running_machine *machine)
 	if (our_target == NULL)
 		fatalerror("Error creating render target");
 
+	// render frames that aren't handed out as-is on all processors
+	render_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	add_exit_callback(machine, mini_exit);
+
 	// nothing yet to do to initialize sound, since we don't have any
 	// sound updates are handled by osd_update_audio_stream() below
 
@@ -135,6 +153,24 @@ void osd_init(running_machine *machine)
 }
 
 
+//============================================================
+//  mini_exit
+//============================================================
+
+static void mini_exit(running_machine *machine)
+{
+	// free the work queue and our frame
+	if (render_queue != NULL)
+		osd_work_queue_free(render_queue);
+	render_queue = NULL;
+
+	free(frame_buffer);
+	frame_buffer = NULL;
+	frame_buffer_size = 0;
+	frame_base = NULL;
+}
+
+
 //============================================================
 //  osd_wait_for_debugger
 //============================================================
@@ -152,6 +188,7 @@ void osd_wait_for_debugger(const device_config *device, int firststop)
 void osd_update(running_machine *machine, int skip_redraw)
 {
 	const render_primitive_list *primlist;
+	const render_texinfo *direct;
 	int minwidth, minheight;
 
 	// get the minimum width/height for the current layout
@@ -165,7 +202,33 @@ void osd_update(running_machine *machine, int skip_redraw)
 
 	// lock them, and then render them
 	osd_lock_acquire(primlist->lock);
-	// do the drawing here
+
+	// a lone RGB32 screen at 1:1 is already our frame; the core leaves the
+	// bitmap alone until the next update, so just point at it
+	direct = render_primitive_list_get_direct(primlist, minwidth, minheight);
+	if (direct != NULL)
+	{
+		frame_base = (const UINT32 *)direct->base;
+		frame_rowpixels = direct->rowpixels;
+	}
+
+	// anything else gets rendered into our own buffer
+	else
+	{
+		if (frame_buffer == NULL || frame_buffer_size < minwidth * minheight)
+		{
+			free(frame_buffer);
+			frame_buffer_size = minwidth * minheight;
+			frame_buffer = (UINT32 *)malloc(frame_buffer_size * sizeof(*frame_buffer));
+			if (frame_buffer == NULL)
+				fatalerror("Error allocating frame buffer");
+		}
+		mini_rgb888_draw_primitives(primlist->head, frame_buffer, minwidth, minheight, minwidth, render_queue);
+		frame_base = frame_buffer;
+		frame_rowpixels = minwidth;
+	}
+	frame_width = minwidth;
+	frame_height = minheight;
 	osd_lock_release(primlist->lock);
 
 	// after 5 seconds, exit
@@ -174,6 +237,23 @@ void osd_update(running_machine *machine, int skip_redraw)
 }
 
 
+//============================================================
+//  osd_mini_get_frame
+//============================================================
+
+const UINT32 *osd_mini_get_frame(int *width, int *height, int *rowpixels)
+{
+	// the pointer is only good until emulation resumes
+	if (width != NULL)
+		*width = frame_width;
+	if (height != NULL)
+		*height = frame_height;
+	if (rowpixels != NULL)
+		*rowpixels = frame_rowpixels;
+	return frame_base;
+}
+
+
 //============================================================
 //  osd_update_audio_stream
 //============================================================
@@ -221,3 +301,19 @@ static INT32 keyboard_get_state(void *device_internal, void *item_internal)
 	UINT8 *keystate = (UINT8 *)item_internal;
 	return *keystate;
 }
+
+
+//============================================================
+//  SOFTWARE RENDERING
+//============================================================
+
+#define FUNC_PREFIX(x)		mini_rgb888_##x
+#define PIXEL_TYPE			UINT32
+#define SRCSHIFT_R			0
+#define SRCSHIFT_G			0
+#define SRCSHIFT_B			0
+#define DSTSHIFT_R			16
+#define DSTSHIFT_G			8
+#define DSTSHIFT_B			0
+
+#include "rendersw.c"
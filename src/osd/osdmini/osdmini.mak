@@ -72,6 +72,16 @@ OSDOBJS = \
 
 
 
+#-------------------------------------------------
+# extra scale effects, include the scale.mak
+#-------------------------------------------------
+
+ifneq ($(USE_SCALE_EFFECTS),)
+include $(SRC)/osd/scale/scale.mak
+endif
+
+
+
 #-------------------------------------------------
 # rules for building the libaries
 #-------------------------------------------------
@@ -163,6 +163,9 @@ void hq2x_32_def(interp_uint32* restrict volatile dst0, interp_uint32* restrict
 			c[8] = c[7];
 		}
 
+#ifdef INTERP_32_DIFF_MASK
+		mask = interp_32_diff_mask(c);
+#else
 		mask = 0;
 
 		if (interp_32_diff(c[0], c[4]))
@@ -181,6 +184,7 @@ void hq2x_32_def(interp_uint32* restrict volatile dst0, interp_uint32* restrict
 			mask |= 1 << 6;
 		if (interp_32_diff(c[8], c[4]))
 			mask |= 1 << 7;
+#endif
 
 #define P(a, b) dst##b[a]
 #define MUR interp_32_diff(c[1], c[5])
@@ -160,6 +160,9 @@ void hq3x_32_def(interp_uint32* restrict dst0, interp_uint32* restrict dst1, int
 			c[8] = c[7];
 		}
 
+#ifdef INTERP_32_DIFF_MASK
+		mask = interp_32_diff_mask(c);
+#else
 		mask = 0;
 
 		if (interp_32_diff(c[0], c[4]))
@@ -178,6 +181,7 @@ void hq3x_32_def(interp_uint32* restrict dst0, interp_uint32* restrict dst1, int
 			mask |= 1 << 6;
 		if (interp_32_diff(c[8], c[4]))
 			mask |= 1 << 7;
+#endif
 
 #define P(a, b) dst##b[a]
 #define MUR interp_32_diff(c[1], c[5])
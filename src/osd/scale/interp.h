@@ -871,4 +871,52 @@ INLINE int interp_32_diff(UINT32 p1, UINT32 p2)
 
 	return 0;
 }
+
+/* compare the eight neighbours c[0..3,5..8] against the centre c[4] at once;
+   bit n of the result matches interp_32_diff on the n-th neighbour */
+#ifdef __SSE2__
+#define INTERP_32_DIFF_MASK
+
+#include <emmintrin.h>
+
+INLINE unsigned interp_32_diff_mask(const UINT32 *c)
+{
+	const __m128i chanmask = _mm_set1_epi32(0xff);
+	const __m128i cmpmask = _mm_set1_epi32(0xF8F8F8);
+	__m128i n0 = _mm_setr_epi32(c[0], c[1], c[2], c[3]);
+	__m128i n1 = _mm_setr_epi32(c[5], c[6], c[7], c[8]);
+	__m128i cc = _mm_set1_epi32(c[4]);
+	__m128i same, r, g, b, y, u, v, over;
+
+	/* neighbours that match in the top 5 bits of each channel never differ */
+	same = _mm_packs_epi32(
+		_mm_cmpeq_epi32(_mm_and_si128(n0, cmpmask), _mm_and_si128(cc, cmpmask)),
+		_mm_cmpeq_epi32(_mm_and_si128(n1, cmpmask), _mm_and_si128(cc, cmpmask)));
+
+	/* signed per-channel differences, one neighbour per 16-bit lane */
+	b = _mm_sub_epi16(
+		_mm_packs_epi32(_mm_and_si128(n0, chanmask), _mm_and_si128(n1, chanmask)),
+		_mm_packs_epi32(_mm_and_si128(cc, chanmask), _mm_and_si128(cc, chanmask)));
+	g = _mm_sub_epi16(
+		_mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(n0, 8), chanmask), _mm_and_si128(_mm_srli_epi32(n1, 8), chanmask)),
+		_mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(cc, 8), chanmask), _mm_and_si128(_mm_srli_epi32(cc, 8), chanmask)));
+	r = _mm_sub_epi16(
+		_mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(n0, 16), chanmask), _mm_and_si128(_mm_srli_epi32(n1, 16), chanmask)),
+		_mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(cc, 16), chanmask), _mm_and_si128(_mm_srli_epi32(cc, 16), chanmask)));
+
+	/* y/u/v outside the limits in either direction */
+	y = _mm_add_epi16(_mm_add_epi16(r, g), b);
+	u = _mm_sub_epi16(r, b);
+	v = _mm_sub_epi16(_mm_add_epi16(g, g), _mm_add_epi16(r, b));
+	y = _mm_max_epi16(y, _mm_sub_epi16(_mm_setzero_si128(), y));
+	u = _mm_max_epi16(u, _mm_sub_epi16(_mm_setzero_si128(), u));
+	v = _mm_max_epi16(v, _mm_sub_epi16(_mm_setzero_si128(), v));
+	over = _mm_or_si128(_mm_cmpgt_epi16(y, _mm_set1_epi16(INTERP_Y_LIMIT)),
+			_mm_or_si128(_mm_cmpgt_epi16(u, _mm_set1_epi16(INTERP_U_LIMIT)),
+						 _mm_cmpgt_epi16(v, _mm_set1_epi16(INTERP_V_LIMIT))));
+
+	over = _mm_andnot_si128(same, over);
+	return _mm_movemask_epi8(_mm_packs_epi16(over, _mm_setzero_si128())) & 0xff;
+}
+#endif
 #endif
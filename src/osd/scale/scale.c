@@ -7,9 +7,9 @@
 //
 //============================================================
 
-#include <windows.h>
 // MAME headers
 #include "driver.h"
+#include "osdcore.h"
 #ifdef USE_SCALE_EFFECTS
 #include "osdscale.h"
 #endif /* USE_SCALE_EFFECTS */
@@ -43,6 +43,33 @@ enum
 #endif
 #define MAX_SCALE_BANK				(MAX_SCREENS * 2)
 
+// effects are rendered in horizontal bands of source rows
+#define SCALE_BAND_HEIGHT			16
+#define MAX_SCALE_BANDS				32
+
+
+//============================================================
+//	TYPE DEFINITIONS
+//============================================================
+
+typedef struct _scale_band scale_band;
+typedef void (*scale_band_func)(const scale_band *band);
+
+struct _scale_band
+{
+	scale_band_func		func;			// renders rows starty..endy-1
+	UINT8 *				src;			// top-left of the full source
+	UINT8 *				dst;			// top-left of the full destination
+	int					src_pitch;		// source pitch in bytes
+	int					dst_pitch;		// destination pitch in bytes
+	int					width;			// source width
+	int					height;			// full source height
+	int					starty;			// first source row of this band
+	int					endy;			// last source row of this band, exclusive
+	int					depth;			// 15, 16 or 32
+	int					param;			// effect-specific parameter
+};
+
 
 //============================================================
 //	GLOBAL VARIABLES
@@ -65,6 +92,8 @@ UINT32 LUT16to32[65536];
 
 static int use_mmx;
 
+static osd_work_queue *scale_queue;
+
 static UINT8 *scale_buffer[MAX_SCALE_BANK];
 
 static int previous_depth[MAX_SCALE_BANK];
@@ -126,6 +155,10 @@ static void (*scale_scale2x_line_32)(UINT32 *dst0, UINT32 *dst1, const UINT32 *s
 
 static int scale_perform_scale3x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth);
 
+static void scale_perform_bands(scale_band_func func, UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth, int param);
+static void scale_band_sai(const scale_band *band);
+static void scale_band_snes9x_hq(const scale_band *band);
+
 // functions from AdvMAME
 void scale2x_16_def(UINT16* dst0, UINT16* dst1, const UINT16* src0, const UINT16* src1, const UINT16* src2, unsigned count);
 void scale2x_32_def(UINT32* dst0, UINT32* dst1, const UINT32* src0, const UINT32* src1, const UINT32* src2, unsigned count);
@@ -285,13 +318,19 @@ int scale_exit(void)
 		}
 	}
 
+	if (scale_queue != NULL)
+	{
+		osd_work_queue_free(scale_queue);
+		scale_queue = NULL;
+	}
+
 	return 0;
 }
 
 //============================================================
 //	x86_get_features
 //============================================================
-#ifndef PTR64
+#if !defined(PTR64) && (defined(__i386__) || defined(_M_IX86))
 static UINT32 x86_get_features(void)
 {
 	UINT32 features = 0;
@@ -323,7 +362,7 @@ static UINT32 x86_get_features(void)
 #endif /* MSC_VER */
 	return features;
 }
-#endif /* PTR64 */
+#endif /* !PTR64 && x86 */
 
 //============================================================
 //	scale_init
@@ -333,13 +372,17 @@ int scale_init(void)
 {
 	static char name[64];
 
-#ifndef PTR64
+#if !defined(PTR64) && (defined(__i386__) || defined(_M_IX86))
 	UINT32 features = x86_get_features();
 	use_mmx = (features & (1 << 23));
-#endif /* PTR64 */
+#endif /* !PTR64 && x86 */
 
 	scale_exit();
 
+	// the effects are row-local, so bands of rows can be rendered in parallel
+	if (scale_effect.effect != SCALE_EFFECT_NONE)
+		scale_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	scale_effect.xsize = scale_effect.ysize = 1;
 	sprintf(name, "none");
 	scale_effect.name = name;
@@ -543,26 +586,13 @@ int scale_perform_scale(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, in
 			return scale_perform_scale3x(src, dst, src_pitch, dst_pitch, width, height, depth);
 
 		case SCALE_EFFECT_2XSAI:
-			if (depth == 15)
-				_2xSaI((unsigned char*)src, (unsigned int)src_pitch, NULL, (unsigned char*)dst, (unsigned int)dst_pitch, width, height);
-			else
-				_2xSaI32((unsigned char*)src, (unsigned int)src_pitch, NULL, (unsigned char*)dst, (unsigned int)dst_pitch, width, height);
-			return 0;
-
 		case SCALE_EFFECT_SUPER2XSAI:
-			if (depth == 15)
-				Super2xSaI((unsigned char*)src, (unsigned int)src_pitch, NULL, (unsigned char*)dst, (unsigned int)dst_pitch, width, height);
-			else
-				Super2xSaI32((unsigned char*)src, (unsigned int)src_pitch, NULL, (unsigned char*)dst, (unsigned int)dst_pitch, width, height);
-			return 0;
-
 		case SCALE_EFFECT_SUPEREAGLE:
-			if (depth == 15)
-				SuperEagle((unsigned char*)src, (unsigned int)src_pitch, NULL, (unsigned char*)dst, (unsigned int)dst_pitch, width, height);
-			else
-				SuperEagle32((unsigned char*)src, (unsigned int)src_pitch, NULL, (unsigned char*)dst, (unsigned int)dst_pitch, width, height);
+			scale_perform_bands(scale_band_sai, src, dst, src_pitch, dst_pitch, width, height, depth, scale_effect.effect);
 			return 0;
 
+
+
 		case SCALE_EFFECT_2XPM:
 			if (depth != 15)
 				return 1;
@@ -572,7 +602,7 @@ int scale_perform_scale(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, in
 
 		case SCALE_EFFECT_HQ2X:
 			if (depth == 15)
-				RenderHQ2X((unsigned char*)src, (unsigned int)src_pitch, (unsigned char*)dst, (unsigned int)dst_pitch, width, height, 2);
+				scale_perform_bands(scale_band_snes9x_hq, src, dst, src_pitch, dst_pitch, width, height, depth, 2);
 			else
 				return scale_perform_hq2x(src, dst, src_pitch, dst_pitch, width, height, depth);
 
@@ -580,18 +610,18 @@ int scale_perform_scale(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, in
 
 		case SCALE_EFFECT_HQ2XS:
 			if (depth == 15)
-				RenderHQ2X((unsigned char*)src, (unsigned int)src_pitch, (unsigned char*)dst, (unsigned int)dst_pitch, width, height, 1);
+				scale_perform_bands(scale_band_snes9x_hq, src, dst, src_pitch, dst_pitch, width, height, depth, 1);
 			else
 				hq2xS32((unsigned char*)src, (unsigned int)src_pitch, NULL, (unsigned char*)dst, (unsigned int)dst_pitch, width, height);
 			return 0;
 
 		case SCALE_EFFECT_HQ2XBOLD:
-			RenderHQ2X((unsigned char*)src, (unsigned int)src_pitch, (unsigned char*)dst, (unsigned int)dst_pitch, width, height, 0);
+			scale_perform_bands(scale_band_snes9x_hq, src, dst, src_pitch, dst_pitch, width, height, depth, 0);
 			return 0;
 
 		case SCALE_EFFECT_HQ3X:
 			if (depth == 15)
-				RenderHQ3X((unsigned char*)src, (unsigned int)src_pitch, (unsigned char*)dst, (unsigned int)dst_pitch, width, height, 2);
+				scale_perform_bands(scale_band_snes9x_hq, src, dst, src_pitch, dst_pitch, width, height, depth, 2);
 			else
 				return scale_perform_hq3x(src, dst, src_pitch, dst_pitch, width, height, depth);
 
@@ -599,11 +629,11 @@ int scale_perform_scale(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, in
 
 		case SCALE_EFFECT_HQ3XS:
 //			hq3xS32((unsigned char*)src, (unsigned int)src_pitch, NULL, (unsigned char*)dst, (unsigned int)dst_pitch, width, height);
-			RenderHQ3X((unsigned char*)src, (unsigned int)src_pitch, (unsigned char*)dst, (unsigned int)dst_pitch, width, height, 1);
+			scale_perform_bands(scale_band_snes9x_hq, src, dst, src_pitch, dst_pitch, width, height, depth, 1);
 			return 0;
 
 		case SCALE_EFFECT_HQ3XBOLD:
-			RenderHQ3X((unsigned char*)src, (unsigned int)src_pitch, (unsigned char*)dst, (unsigned int)dst_pitch, width, height, 0);
+			scale_perform_bands(scale_band_snes9x_hq, src, dst, src_pitch, dst_pitch, width, height, depth, 0);
 			return 0;
 
 		default:
@@ -634,16 +664,164 @@ INLINE void scale_emms(void)
 }
 
 
+
 //============================================================
-//	scale_perform_scale2x
+//	scale_band_callback
 //============================================================
-static int scale_perform_scale2x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth, int bank)
+
+static void *scale_band_callback(void *param, int threadid)
 {
+	const scale_band *band = (const scale_band *)param;
+
+	(*band->func)(band);
+	return NULL;
+}
+
+//============================================================
+//	scale_perform_bands
+//============================================================
+
+static void scale_perform_bands(scale_band_func func, UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth, int param)
+{
+	scale_band band[MAX_SCALE_BANDS];
+	int bands = (height + SCALE_BAND_HEIGHT - 1) / SCALE_BAND_HEIGHT;
+	int bandnum;
+
+	if (bands > MAX_SCALE_BANDS)
+		bands = MAX_SCALE_BANDS;
+	if (scale_queue == NULL || bands < 2)
+		bands = 1;
+
+	for (bandnum = 0; bandnum < bands; bandnum++)
+	{
+		band[bandnum].func = func;
+		band[bandnum].src = src;
+		band[bandnum].dst = dst;
+		band[bandnum].src_pitch = src_pitch;
+		band[bandnum].dst_pitch = dst_pitch;
+		band[bandnum].width = width;
+		band[bandnum].height = height;
+		band[bandnum].starty = height * bandnum / bands;
+		band[bandnum].endy = height * (bandnum + 1) / bands;
+		band[bandnum].depth = depth;
+		band[bandnum].param = param;
+	}
+
+	// a single band is rendered right here
+	if (bands == 1)
+	{
+		(*func)(&band[0]);
+		return;
+	}
+
+	osd_work_item_queue_multiple(scale_queue, scale_band_callback, bands, band, sizeof(band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(scale_queue, osd_ticks_per_second() * 100);
+}
+
+//============================================================
+//	scale_band_rows
+//============================================================
+
+INLINE void scale_band_rows(const scale_band *band, int y, UINT8 **prev, UINT8 **curr, UINT8 **next)
+{
+	*curr = band->src + y * band->src_pitch;
+	*prev = (y > 0) ? *curr - band->src_pitch : *curr;
+	*next = (y < band->height - 1) ? *curr + band->src_pitch : *curr;
+}
+
+//============================================================
+//	scale_band_sai
+//============================================================
+
+static void scale_band_sai(const scale_band *band)
+{
+	UINT8 *src = band->src + band->starty * band->src_pitch;
+	UINT8 *dst = band->dst + 2 * band->starty * band->dst_pitch;
+	int height = band->endy - band->starty;
+
+	// these read the rows around each band directly, exactly as a full pass would
+	switch (band->param)
+	{
+		case SCALE_EFFECT_2XSAI:
+			if (band->depth == 15)
+				_2xSaI(src, (UINT32)band->src_pitch, NULL, dst, (UINT32)band->dst_pitch, band->width, height);
+			else
+				_2xSaI32(src, (UINT32)band->src_pitch, NULL, dst, (UINT32)band->dst_pitch, band->width, height);
+			break;
+
+		case SCALE_EFFECT_SUPER2XSAI:
+			if (band->depth == 15)
+				Super2xSaI(src, (UINT32)band->src_pitch, NULL, dst, (UINT32)band->dst_pitch, band->width, height);
+			else
+				Super2xSaI32(src, (UINT32)band->src_pitch, NULL, dst, (UINT32)band->dst_pitch, band->width, height);
+			break;
+
+		case SCALE_EFFECT_SUPEREAGLE:
+			if (band->depth == 15)
+				SuperEagle(src, (UINT32)band->src_pitch, NULL, dst, (UINT32)band->dst_pitch, band->width, height);
+			else
+				SuperEagle32(src, (UINT32)band->src_pitch, NULL, dst, (UINT32)band->dst_pitch, band->width, height);
+			break;
+	}
+}
+
+//============================================================
+//	scale_band_snes9x_hq
+//============================================================
+
+static void scale_band_snes9x_hq(const scale_band *band)
+{
+	UINT8 *src = band->src + band->starty * band->src_pitch;
+	UINT8 *dst = band->dst + scale_effect.ysize * band->starty * band->dst_pitch;
+	int height = band->endy - band->starty;
+
+	if (scale_effect.ysize == 2)
+		RenderHQ2X((unsigned char*)src, (unsigned int)band->src_pitch, (unsigned char*)dst, (unsigned int)band->dst_pitch, band->width, height, band->param);
+	else
+		RenderHQ3X((unsigned char*)src, (unsigned int)band->src_pitch, (unsigned char*)dst, (unsigned int)band->dst_pitch, band->width, height, band->param);
+}
+
+//============================================================
+//	scale_band_scale2x
+//============================================================
+
+static void scale_band_scale2x(const scale_band *band)
+{
+	UINT8 *src_prev, *src_curr, *src_next;
 	int y;
-	UINT8 *src_prev = src;
-	UINT8 *src_curr = src;
-	UINT8 *src_next = src + src_pitch;
 
+	for (y = band->starty; y < band->endy; y++)
+	{
+		UINT8 *dst = band->dst + 2 * y * band->dst_pitch;
+
+		scale_band_rows(band, y, &src_prev, &src_curr, &src_next);
+
+		// the first row always goes through the plain C version
+		if (band->depth == 15 || band->depth == 16)
+		{
+			if (y == 0)
+				scale2x_16_def((UINT16 *)dst, (UINT16 *)(dst + band->dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, band->width);
+			else
+				scale_scale2x_line_16((UINT16 *)dst, (UINT16 *)(dst + band->dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, band->width);
+		}
+		else
+		{
+			if (y == 0)
+				scale2x_32_def((UINT32 *)dst, (UINT32 *)(dst + band->dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, band->width);
+			else
+				scale_scale2x_line_32((UINT32 *)dst, (UINT32 *)(dst + band->dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, band->width);
+		}
+	}
+
+	scale_emms();
+}
+
+//============================================================
+//	scale_perform_scale2x
+//============================================================
+
+static int scale_perform_scale2x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth, int bank)
+{
 	if (depth != 15 && depth != 16 && depth != 32)
 		return 1;
 
@@ -665,47 +843,30 @@ static int scale_perform_scale2x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_
 		previous_depth[bank] = depth;
 	}
 
-	if (depth == 15 || depth == 16)
-//		scale_scale2x_line_16((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-		scale2x_16_def((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-	else
-//		scale_scale2x_line_32((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-		scale2x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
+	scale_perform_bands(scale_band_scale2x, src, dst, src_pitch, dst_pitch, width, height, depth, 0);
+	return 0;
+}
 
-	if (depth == 15 || depth == 16)
-	{
-		for (y = 2; y < height; y++)
-		{
-			dst += 2 * dst_pitch;
-			src_prev = src_curr;
-			src_curr = src_next;
-			src_next += src_pitch;
-			scale_scale2x_line_16((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-		}
-	}
-	else
-	{
-		for (y = 2; y < height; y++)
-		{
-			dst += 2 * dst_pitch;
-			src_prev = src_curr;
-			src_curr = src_next;
-			src_next += src_pitch;
-			scale_scale2x_line_32((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-		}
-	}
+//============================================================
+//	scale_band_scale3x
+//============================================================
 
-	dst += 2 * dst_pitch;
-	src_prev = src_curr;
-	src_curr = src_next;
-	if (depth == 15 || depth == 16)
-		scale_scale2x_line_16((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-	else
-		scale_scale2x_line_32((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
+static void scale_band_scale3x(const scale_band *band)
+{
+	UINT8 *src_prev, *src_curr, *src_next;
+	int y;
 
-	scale_emms();
+	for (y = band->starty; y < band->endy; y++)
+	{
+		UINT8 *dst = band->dst + 3 * y * band->dst_pitch;
 
-	return 0;
+		scale_band_rows(band, y, &src_prev, &src_curr, &src_next);
+
+		if (band->depth == 15 || band->depth == 16)
+			scale3x_16_def((UINT16 *)dst, (UINT16 *)(dst + band->dst_pitch), (UINT16 *)(dst + 2 * band->dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, band->width);
+		else
+			scale3x_32_def((UINT32 *)dst, (UINT32 *)(dst + band->dst_pitch), (UINT32 *)(dst + 2 * band->dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, band->width);
+	}
 }
 
 //============================================================
@@ -714,117 +875,69 @@ static int scale_perform_scale2x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_
 
 static int scale_perform_scale3x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth)
 {
-	int y;
-	UINT8 *src_prev = src;
-	UINT8 *src_curr = src;
-	UINT8 *src_next = src + src_pitch;
-
 	if (depth != 15 && depth != 16 && depth != 32)
 		return 1;
 
-	if (depth == 15 || depth == 16)
-		scale3x_16_def((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)(dst + 2 * dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-	else
-		scale3x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)(dst + 2 * dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-
-	if (depth == 15 || depth == 16)
-	{
-		for (y = 2; y < height; y++)
-		{
-			dst	+= 3 * dst_pitch;
-			src_prev = src_curr;
-			src_curr = src_next;
-			src_next += src_pitch;
-			scale3x_16_def((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)(dst + 2 * dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-		}
-	}
-	else
-	{
-		for (y = 2; y < height; y++)
-		{
-			dst += 3 * dst_pitch;
-			src_prev = src_curr;
-			src_curr = src_next;
-			src_next += src_pitch;
-			scale3x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)(dst + 2 * dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-		}
-	}
-
-	dst += 3 * dst_pitch;
-	src_prev = src_curr;
-	src_curr = src_next;
-	if (depth == 15 || depth == 16)
-		scale3x_16_def((UINT16 *)dst, (UINT16 *)(dst + dst_pitch), (UINT16 *)(dst + 2 * dst_pitch), (UINT16 *)src_prev, (UINT16 *)src_curr, (UINT16 *)src_next, width);
-	else
-		scale3x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)(dst + 2 * dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-
+	scale_perform_bands(scale_band_scale3x, src, dst, src_pitch, dst_pitch, width, height, depth, 0);
 	return 0;
 }
 
 //============================================================
-//	scale_perform_hq2x
+//	scale_band_hq2x
 //============================================================
 
-static int scale_perform_hq2x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth)
+static void scale_band_hq2x(const scale_band *band)
 {
+	UINT8 *src_prev, *src_curr, *src_next;
 	int y;
-	UINT8 *src_prev = src;
-	UINT8 *src_curr = src;
-	UINT8 *src_next = src + src_pitch;
 
-	interp_init();
-
-	hq2x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
-
-	for (y = 2; y < height; y++)
+	for (y = band->starty; y < band->endy; y++)
 	{
-		dst += 2 * dst_pitch;
-		src_prev = src_curr;
-		src_curr = src_next;
-		src_next += src_pitch;
+		UINT8 *dst = band->dst + 2 * y * band->dst_pitch;
 
-		hq2x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
+		scale_band_rows(band, y, &src_prev, &src_curr, &src_next);
+		hq2x_32_def((UINT32 *)dst, (UINT32 *)(dst + band->dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, band->width);
 	}
+}
 
-	dst += 2 * dst_pitch;
-	src_prev = src_curr;
-	src_curr = src_next;
+//============================================================
+//	scale_perform_hq2x
+//============================================================
 
-	hq2x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
+static int scale_perform_hq2x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth)
+{
+	interp_init();
 
+	scale_perform_bands(scale_band_hq2x, src, dst, src_pitch, dst_pitch, width, height, depth, 0);
 	return 0;
 }
 
 //============================================================
-//	scale_perform_hq3x
+//	scale_band_hq3x
 //============================================================
 
-static int scale_perform_hq3x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth)
+static void scale_band_hq3x(const scale_band *band)
 {
+	UINT8 *src_prev, *src_curr, *src_next;
 	int y;
-	UINT8 *src_prev = src;
-	UINT8 *src_curr = src;
-	UINT8 *src_next = src + src_pitch;
-
-	interp_init();
-	
-	hq3x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)(dst + 2 * dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
 
-	for (y = 2; y < height; y++)
+	for (y = band->starty; y < band->endy; y++)
 	{
-		dst += 3 * dst_pitch;
-		src_prev = src_curr;
-		src_curr = src_next;
-		src_next += src_pitch;
+		UINT8 *dst = band->dst + 3 * y * band->dst_pitch;
 
-		hq3x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)(dst + 2 * dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
+		scale_band_rows(band, y, &src_prev, &src_curr, &src_next);
+		hq3x_32_def((UINT32 *)dst, (UINT32 *)(dst + band->dst_pitch), (UINT32 *)(dst + 2 * band->dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, band->width);
 	}
+}
 
-	dst += 3 * dst_pitch;
-	src_prev = src_curr;
-	src_curr = src_next;
+//============================================================
+//	scale_perform_hq3x
+//============================================================
 
-	hq3x_32_def((UINT32 *)dst, (UINT32 *)(dst + dst_pitch), (UINT32 *)(dst + 2 * dst_pitch), (UINT32 *)src_prev, (UINT32 *)src_curr, (UINT32 *)src_next, width);
+static int scale_perform_hq3x(UINT8 *src, UINT8 *dst, int src_pitch, int dst_pitch, int width, int height, int depth)
+{
+	interp_init();
 
+	scale_perform_bands(scale_band_hq3x, src, dst, src_pitch, dst_pitch, width, height, depth, 0);
 	return 0;
 }
@@ -10,7 +10,7 @@
 ###########################################################################
 
 
-SCALEOBJ = $(WINOBJ)/scale
+SCALEOBJ = $(OBJ)/osd/scale
 
 OBJDIRS += $(SCALEOBJ)
 
@@ -21,6 +21,7 @@ OBJDIRS += $(SCALEOBJ)
 #-------------------------------------------------
 
 OSDOBJS += \
+	$(SCALEOBJ)/scale.o \
 	$(SCALEOBJ)/scale2x.o \
 	$(SCALEOBJ)/scale3x.o \
 	$(SCALEOBJ)/2xpm.o \
@@ -31,8 +32,18 @@ OSDOBJS += \
 	$(SCALEOBJ)/scanline.o \
 	$(SCALEOBJ)/snes9x_render.o \
 
+# the MMX kernels are 32-bit x86 only; the Windows OSD always is,
+# other targets ask the compiler what it builds for
 ifndef PTR64
-DEFS += -DUSE_MMX_INTERP_SCALE
+ifeq ($(OSD),windows)
+SCALE_X86 = 1
+else
+ifneq ($(filter i386% i486% i586% i686% x86% mingw32%,$(shell $(subst @,,$(CC)) -dumpmachine 2>/dev/null)),)
+SCALE_X86 = 1
+endif
+endif
 endif
 
-
+ifdef SCALE_X86
+DEFS += -DUSE_MMX_INTERP_SCALE
+endif
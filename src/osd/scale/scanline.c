@@ -16,7 +16,7 @@
 // along with this program; if not, write to the Free Software Foundation,
 // Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
 
-#include "Port.h"
+#include "port.h"
 
 int RGB_LOW_BITS_MASK = 0x421;
 //extern int RGB_LOW_BITS_MASK;
@@ -458,6 +458,7 @@ static int update_window_size(win_window_info *window);
 
 // drawing
 static void draw_line(d3d_info *d3d, const render_primitive *prim);
+static void draw_lines(d3d_info *d3d, const render_primitive *prim);
 static void draw_quad(d3d_info *d3d, const render_primitive *prim);
 
 // primitives
@@ -666,6 +667,10 @@ mtlog_add("drawd3d_window_draw: primitive loop begin");
 				draw_line(d3d, prim);
 				break;
 
+			case RENDER_PRIMITIVE_LINES:
+				draw_lines(d3d, prim);
+				break;
+
 			case RENDER_PRIMITIVE_QUAD:
 				draw_quad(d3d, prim);
 				break;
@@ -1496,6 +1501,26 @@ static void draw_line(d3d_info *d3d, const render_primitive *prim)
 
 
 
+//============================================================
+//  draw_lines
+//============================================================
+
+static void draw_lines(d3d_info *d3d, const render_primitive *prim)
+{
+	render_primitive segprim = *prim;
+	UINT32 segnum;
+
+	// each segment goes down the same path as a standalone line
+	for (segnum = 0; segnum < prim->numsegments; segnum++)
+	{
+		segprim.bounds = prim->segments[segnum].bounds;
+		segprim.color = prim->segments[segnum].color;
+		draw_line(d3d, &segprim);
+	}
+}
+
+
+
 //============================================================
 //  draw_quad
 //============================================================
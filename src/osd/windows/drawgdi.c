@@ -64,6 +64,7 @@ struct _gdi_info
 	RGBQUAD					colors[256];
 	UINT8 *					bmdata;
 	size_t					bmsize;
+	osd_work_queue *		queue;
 };
 
 
@@ -80,7 +81,7 @@ static const render_primitive_list *drawgdi_window_get_primitives(win_window_inf
 static int drawgdi_window_draw(win_window_info *window, HDC dc, int update);
 
 // rendering
-static void drawgdi_rgb888_draw_primitives(const render_primitive *primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch);
+static void drawgdi_rgb888_draw_primitives(const render_primitive *primlist, void *dstdata, UINT32 width, UINT32 height, UINT32 pitch, osd_work_queue *queue);
 
 
 
@@ -143,6 +144,9 @@ static int drawgdi_window_init(win_window_info *window)
 		gdi->bminfo.bmiColors[i].rgbReserved	= i;
 	}
 
+	// create a work queue for rendering
+	gdi->queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
 	return 0;
 }
 
@@ -163,6 +167,8 @@ static void drawgdi_window_destroy(win_window_info *window)
 	// free the bitmap memory
 	if (gdi->bmdata != NULL)
 		free(gdi->bmdata);
+	if (gdi->queue != NULL)
+		osd_work_queue_free(gdi->queue);
 	free(gdi);
 	window->drawdata = NULL;
 }
@@ -214,7 +220,7 @@ static int drawgdi_window_draw(win_window_info *window, HDC dc, int update)
 
 	// draw the primitives to the bitmap
 	osd_lock_acquire(window->primlist->lock);
-	drawgdi_rgb888_draw_primitives(window->primlist->head, gdi->bmdata, width, height, pitch);
+	drawgdi_rgb888_draw_primitives(window->primlist->head, gdi->bmdata, width, height, pitch, gdi->queue);
 	osd_lock_release(window->primlist->lock);
 
 	// fill in bitmap-specific info
@@ -358,8 +358,7 @@ endif
 #-------------------------------------------------
 
 ifneq ($(USE_SCALE_EFFECTS),)
-OSDOBJS += $(WINOBJ)/scale.o
-include $(SRC)/osd/windows/scale/scale.mak
+include $(SRC)/osd/scale/scale.mak
 endif
 
 